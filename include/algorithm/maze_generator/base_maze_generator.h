@@ -1,5 +1,6 @@
 #pragma once
 
+#include <optional>
 #include <random>
 #include <stdexcept>
 
@@ -11,6 +12,9 @@ class BaseMazeGenerator
     static const size_t min_width  = 3;
     static const size_t min_height = 3;
 
+    /** Seed of the random generator, random seed is used if not set */
+    std::optional<std::mt19937::result_type> seed;
+
     /**
      * @brief Generate a maze from `start` to `goal`
      *
@@ -34,7 +38,7 @@ class BaseMazeGenerator
     void validateArguments(const Grid &grid, const Grid::Location &start, const Grid::Location &goal);
 
     /**
-     * @brief Get the Random Generator
+     * @brief Get the Random Generator seeded with `seed` if it is set
      *
      * @return std::mt19937
      */
@@ -7,9 +7,14 @@
 
 #include "algorithm/maze_generator/base_maze_generator.h"
 #include "data_structure/grid.h"
+#include "utility/recording.h"
 #include "utility/timer.h"
 
-class BlockMazeGenerator : BaseMazeGenerator
+/**
+ * @tparam Recording - which removed cells are saved to the record, one of
+ * `FullRecording`, `SampledRecording<>` or `NoRecording`
+ */
+template <typename Recording = FullRecording> class BlockMazeGenerator : public BaseMazeGenerator
 {
   public:
     /**
@@ -32,6 +37,7 @@ class BlockMazeGenerator : BaseMazeGenerator
         Grid::Location                                                        to,
         std::vector<Grid::ChangeRecord>                                      &record,
         Timer<std::chrono::microseconds, std::chrono::high_resolution_clock> &timer,
+        Recording                                                            &recording,
         unsigned                                                             &step
     );
 };
@@ -5,9 +5,14 @@
 
 #include "algorithm/maze_generator/base_maze_generator.h"
 #include "data_structure/grid.h"
+#include "utility/recording.h"
 #include "utility/timer.h"
 
-class DepthFirstSearchMazeGenerator : BaseMazeGenerator
+/**
+ * @tparam Recording - which carved cells are saved to the record, one of
+ * `FullRecording`, `SampledRecording<>` or `NoRecording`
+ */
+template <typename Recording = FullRecording> class DepthFirstSearchMazeGenerator : public BaseMazeGenerator
 {
   public:
     /**
@@ -1,17 +1,136 @@
 #pragma once
 
 #include <functional>
-#include <unordered_map>
 #include <vector>
 
-#include "algorithm/pathfinder/base_path_finder.h"
+#include "algorithm/pathfinder/best_first_search.h"
+#include "algorithm/pathfinder/search_policy.h"
+#include "data_structure/bucket_queue.h"
+#include "data_structure/indexed_heap.h"
 #include "data_structure/priority_queue.h"
-#include "utility/timer.h"
+#include "data_structure/search_workspace.h"
+#include "utility/recording.h"
 
-template <typename Graph> class AStarSearch : BasePathFinder<Graph>
+/**
+ * A* search, best-first search ordered by cost of the way plus estimated cost
+ * to the goal
+ *
+ * @tparam Graph
+ * @tparam Frontier - queue of location indices ordered by cost, one of
+ * `PriorityQueue`, `BucketQueue` or `IndexedHeap`
+ * @tparam Recording - which expansions are saved to the record, one of
+ * `FullRecording`, `SampledRecording` or `NoRecording`
+ */
+template <
+    typename Graph,
+    typename Frontier  = PriorityQueue<typename Graph::index_t, typename Graph::cost_t>,
+    typename Recording = FullRecording>
+class AStarSearch : BasePathFinder<Graph>
 {
   private:
   public:
+    /**
+     * @brief Search a path from `start` to `goal` in a graph with heuristic
+     * and cost known at compile time
+     *
+     * @tparam Heuristic - functor of two locations, see `search_policy.h`
+     * @tparam Cost - functor of two locations, see `search_policy.h`
+     * @tparam Connectivity - functor of two locations that is false when no
+     * path between them exists, see `search_policy.h`
+     * @param graph - graph to search
+     * @param start
+     * @param goal
+     * @param heuristic - heuristic to determine distance from the goal
+     * @param cost - cost of a step between two neighbors
+     * @param record - list of steps taken by the algorithm. Saves location
+     * (`Location`), time taken (`std::chrono::microseconds`), and a cost of
+     * location (`Graph::cost_t`), not saved if `nullptr`
+     * @param workspace - memory of the search, reused between searches
+     * @param connectivity - checked before the search, so a goal that cannot
+     * be reached is rejected at once
+     *
+     * @return std::vector<Location> - path from `start` to `goal`
+     */
+    template <typename Heuristic, typename Cost, typename Connectivity = FullConnectivity<Graph>>
+    static std::vector<typename Graph::Location> search(
+        const Graph                               &graph,
+        const typename Graph::Location            &start,
+        const typename Graph::Location            &goal,
+        const Heuristic                           &heuristic,
+        const Cost                                &cost,
+        std::vector<typename Graph::ChangeRecord> *record,
+        SearchWorkspace<Graph, Frontier>          &workspace,
+        const Connectivity                        &connectivity = Connectivity()
+    )
+    {
+        return BestFirstSearch<Graph, Frontier, Recording>::search(
+            graph, start, goal, AStarPriority<Graph, Heuristic>{heuristic}, cost, record, workspace, connectivity
+        );
+    }
+
+    /**
+     * @brief Search a path from `start` to `goal` in a graph with heuristic
+     * and cost known at compile time
+     *
+     * @tparam Heuristic - functor of two locations, see `search_policy.h`
+     * @tparam Cost - functor of two locations, see `search_policy.h`
+     * @tparam Connectivity - functor of two locations that is false when no
+     * path between them exists, see `search_policy.h`
+     * @param graph - graph to search
+     * @param start
+     * @param goal
+     * @param heuristic - heuristic to determine distance from the goal
+     * @param cost - cost of a step between two neighbors
+     * @param record - list of steps taken by the algorithm. Saves location
+     * (`Location`), time taken (`std::chrono::microseconds`), and a cost of
+     * location (`Graph::cost_t`)
+     * @param connectivity - checked before the search, so a goal that cannot
+     * be reached is rejected at once
+     *
+     * @return std::vector<Location> - path from `start` to `goal`
+     */
+    template <typename Heuristic, typename Cost, typename Connectivity = FullConnectivity<Graph>>
+    static std::vector<typename Graph::Location> search(
+        const Graph                               &graph,
+        const typename Graph::Location            &start,
+        const typename Graph::Location            &goal,
+        const Heuristic                           &heuristic,
+        const Cost                                &cost,
+        std::vector<typename Graph::ChangeRecord> &record,
+        const Connectivity                        &connectivity = Connectivity()
+    )
+    {
+        return AStarSearch::search(
+            graph, start, goal, heuristic, cost, &record, SearchWorkspace<Graph, Frontier>::local(), connectivity
+        );
+    }
+
+    /**
+     * @brief Search a path from `start` to `goal` in a graph
+     *
+     * @param graph - graph to search
+     * @param start
+     * @param goal
+     * @param heuristic - heuristic to determine distance from the goal
+     * @param record - list of steps taken by the algorithm. Saves location
+     * (`Location`),time taken (`std::chrono::microseconds`) , and a cost of
+     * location (`Graph::cost_t`), not saved if `nullptr`
+     * @param workspace - memory of the search, reused between searches
+     *
+     * @return std::vector<Location> - path from `start` to `goal`
+     */
+    static std::vector<typename Graph::Location> search(
+        const Graph                                                                              &graph,
+        const typename Graph::Location                                                           &start,
+        const typename Graph::Location                                                           &goal,
+        std::function<typename Graph::cost_t(typename Graph::Location, typename Graph::Location)> heuristic,
+        std::vector<typename Graph::ChangeRecord>                                                *record,
+        SearchWorkspace<Graph, Frontier>                                                         &workspace
+    )
+    {
+        return AStarSearch::search(graph, start, goal, heuristic, GraphCost<Graph>{graph}, record, workspace);
+    }
+
     /**
      * @brief Search a path from `start` to `goal` in a graph
      *
@@ -33,41 +152,6 @@ template <typename Graph> class AStarSearch : BasePathFinder<Graph>
         std::vector<typename Graph::ChangeRecord>                                                &record
     )
     {
-        std::unordered_map<typename Graph::Location, typename Graph::cost_t>   cost_so_far;
-        PriorityQueue<typename Graph::Location, typename Graph::cost_t>        frontier;
-        std::unordered_map<typename Graph::Location, typename Graph::Location> came_from;
-
-        frontier.push(start, typename Graph::cost_t(0));
-        came_from[start]   = start;
-        cost_so_far[start] = typename Graph::cost_t(0);
-
-        Timer timer;
-
-        while (!frontier.empty())
-        {
-            typename Graph::Location current = frontier.pop();
-
-            timer.tock();
-            record.push_back({current, timer.duration(), 0, cost_so_far[current]});
-
-            if (current == goal)
-            {
-                break;
-            }
-
-            for (typename Graph::Location next : graph.neighbors(current))
-            {
-                typename Graph::cost_t new_cost = cost_so_far[current] + graph.cost(current, next);
-                if (cost_so_far.find(next) == cost_so_far.end() || new_cost < cost_so_far[next])
-                {
-                    cost_so_far[next]               = new_cost;
-                    came_from[next]                 = current;
-                    typename Graph::cost_t priority = new_cost + heuristic(next, goal);
-                    frontier.push(next, priority);
-                }
-            }
-        }
-
-        return AStarSearch::reconstruct_path(start, goal, came_from);
+        return AStarSearch::search(graph, start, goal, heuristic, &record, SearchWorkspace<Graph, Frontier>::local());
     }
 };
@@ -0,0 +1,361 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "algorithm/pathfinder/base_path_finder.h"
+#include "algorithm/pathfinder/search_policy.h"
+#include "data_structure/dense_search_state.h"
+#include "data_structure/priority_queue.h"
+#include "data_structure/search_workspace.h"
+#include "utility/recording.h"
+#include "utility/timer.h"
+
+/**
+ * Weights and limits of an anytime search. Search stops when either limit is
+ * reached, or when the path is proven to be the cheapest one
+ */
+struct AnytimeSchedule
+{
+    /** Weight of the heuristic in the first search, at least 1 */
+    double initial_weight = 3.0;
+
+    /** Amount by which weight is lowered after every found path */
+    double weight_step = 0.5;
+
+    /** Wall-clock time the search may take */
+    std::chrono::microseconds time = std::chrono::microseconds::max();
+
+    /** Amount of locations the search may expand */
+    size_t expansions = std::numeric_limits<size_t>::max();
+};
+
+/**
+ * Path found by an anytime search
+ *
+ * @tparam Graph
+ */
+template <typename Graph> struct AnytimeSolution
+{
+    std::vector<typename Graph::Location> path;
+
+    /** Cost of the path */
+    typename Graph::cost_t cost;
+
+    /** Heuristic weight the path was found with */
+    double weight;
+
+    /** Cost of the path is at most `bound` times the cost of the cheapest one */
+    double bound;
+
+    /** Locations expanded since the start of the search */
+    size_t expanded;
+
+    /** Time since the start of the search */
+    std::chrono::microseconds time;
+};
+
+/**
+ * Anytime Repairing A* (ARA*). Finds a first path quickly with a heuristic
+ * inflated by `AnytimeSchedule::initial_weight`, then lowers the weight and
+ * repairs that search instead of starting a new one, until the weight reaches
+ * 1 or a limit of the schedule is reached. Locations are expanded at most
+ * once per weight; a location whose cost drops after it was expanded waits
+ * in an inconsistent list for the next weight.
+ *
+ * Each path is reported with a bound on how much more it costs than the
+ * cheapest one, which is the weight or less if the remaining frontier proves
+ * a tighter one
+ *
+ * @tparam Graph
+ * @tparam Frontier - queue of location indices ordered by cost, one of
+ * `PriorityQueue` or `IndexedHeap`. Inflated priorities are not monotone, so
+ * `BucketQueue` cannot be used
+ * @tparam Recording - which expansions are saved to the record, one of
+ * `FullRecording`, `SampledRecording` or `NoRecording`
+ */
+template <
+    typename Graph,
+    typename Frontier  = PriorityQueue<typename Graph::index_t, typename Graph::cost_t>,
+    typename Recording = FullRecording>
+class AnytimeAStarSearch : BasePathFinder<Graph>
+{
+  public:
+    typedef AnytimeSolution<Graph> Solution;
+
+    /**
+     * @brief Search paths from `start` to `goal`, each cheaper than the one
+     * before, in a graph with heuristic and cost known at compile time
+     *
+     * @tparam Heuristic - consistent functor of two locations, see
+     * `search_policy.h`
+     * @tparam Cost - functor of two locations, see `search_policy.h`
+     * @param graph - graph to search
+     * @param start
+     * @param goal
+     * @param heuristic - heuristic to determine distance from the goal
+     * @param cost - cost of a step between two neighbors
+     * @param schedule - weights and limits of the search
+     * @param record - list of steps taken by the algorithm. Saves location
+     * (`Location`), time taken (`std::chrono::microseconds`), and a cost of
+     * location (`Graph::cost_t`), not saved if `nullptr`
+     * @param report - called with every found path as soon as it is found,
+     * not called if empty
+     *
+     * @return std::vector<Solution> - found paths, each cheaper than the one
+     * before, empty if no path was found within limits
+     */
+    template <typename Heuristic, typename Cost>
+    static std::vector<Solution> search(
+        const Graph                                 &graph,
+        const typename Graph::Location              &start,
+        const typename Graph::Location              &goal,
+        const Heuristic                             &heuristic,
+        const Cost                                  &cost,
+        const AnytimeSchedule                       &schedule,
+        std::vector<typename Graph::ChangeRecord>   *record,
+        const std::function<void(const Solution &)> &report = nullptr
+    )
+    {
+        if (schedule.initial_weight < 1.0 || schedule.weight_step <= 0.0)
+        {
+            throw std::invalid_argument(
+                "Argument exception: Cannot search anytime path. Weight must be at least 1 and step must be positive."
+            );
+        }
+
+        SearchWorkspace<Graph, Frontier> workspace(graph.size());
+
+        DenseSearchState<Graph> &state    = workspace.state;
+        Frontier                &frontier = workspace.frontier;
+
+        // location is closed while its stamp equals the current weight round,
+        // so starting a round reopens every location at once
+        std::vector<uint32_t> closed(graph.size(), 0);
+        std::vector<uint32_t> listed(graph.size(), 0);
+        uint32_t              round = 1;
+
+        std::vector<typename Graph::index_t> inconsistent;
+        std::vector<typename Graph::index_t> open;
+        std::vector<Solution>                solutions;
+
+        typename Graph::index_t start_index = graph.index(start);
+        typename Graph::index_t goal_index  = graph.index(goal);
+
+        double weight = schedule.initial_weight;
+
+        auto priority = [&](const typename Graph::index_t index) {
+            return (typename Graph::cost_t)(
+                state.cost(index) + (typename Graph::cost_t)(weight * heuristic(graph.location(index), goal))
+            );
+        };
+
+        state.set(start_index, typename Graph::cost_t(0), start_index);
+        frontier.push(start_index, priority(start_index));
+
+        Timer     timer;
+        Recording recording;
+        size_t    expanded = 0;
+
+        while (true)
+        {
+            bool is_exhausted = false;
+
+            while (!frontier.empty())
+            {
+                typename Graph::index_t current_index = frontier.pop();
+
+                // stale entry of a location that was already expanded this round
+                if (closed[current_index] == round)
+                {
+                    continue;
+                }
+
+                if (state.isVisited(goal_index) && state.cost(goal_index) <= priority(current_index))
+                {
+                    frontier.push(current_index, priority(current_index)); // still open for the next round
+                    break;
+                }
+
+                if (expanded >= schedule.expansions)
+                {
+                    is_exhausted = true;
+                    break;
+                }
+
+                // clock is read only once in a while, reading it costs more than an expansion
+                if (expanded % 256 == 0)
+                {
+                    timer.tock();
+
+                    if (timer.duration() >= schedule.time)
+                    {
+                        is_exhausted = true;
+                        break;
+                    }
+                }
+
+                closed[current_index] = round;
+                expanded++;
+
+                typename Graph::Location current = graph.location(current_index);
+
+                if (record != nullptr && recording.take())
+                {
+                    timer.tock();
+                    record->push_back({current, timer.duration(), 0, state.cost(current_index)});
+                }
+
+                for (const typename Graph::Location &next : graph.neighbors(current))
+                {
+                    typename Graph::index_t next_index = graph.index(next);
+                    typename Graph::cost_t  new_cost   = state.cost(current_index) + cost(current, next);
+
+                    if (state.isVisited(next_index) && new_cost >= state.cost(next_index))
+                    {
+                        continue;
+                    }
+
+                    state.set(next_index, new_cost, current_index);
+
+                    if (closed[next_index] == round)
+                    {
+                        inconsistent.push_back(next_index);
+                    }
+                    else
+                    {
+                        frontier.push(next_index, priority(next_index));
+                    }
+                }
+            }
+
+            if (is_exhausted || !state.isVisited(goal_index))
+            {
+                break; // limit was reached or goal cannot be reached
+            }
+
+            // locations left open, without stale entries and duplicates
+            open.clear();
+
+            while (!frontier.empty())
+            {
+                typename Graph::index_t index = frontier.pop();
+
+                if (closed[index] != round && listed[index] != round)
+                {
+                    listed[index] = round;
+                    open.push_back(index);
+                }
+            }
+
+            for (typename Graph::index_t index : inconsistent)
+            {
+                if (listed[index] != round)
+                {
+                    listed[index] = round;
+                    open.push_back(index);
+                }
+            }
+
+            inconsistent.clear();
+
+            // cheapest path costs at least the lowest cost a not expanded location could lead to
+            typename Graph::cost_t lower_bound = state.cost(goal_index);
+
+            for (typename Graph::index_t index : open)
+            {
+                lower_bound = std::min(lower_bound, state.cost(index) + heuristic(graph.location(index), goal));
+            }
+
+            timer.tock();
+
+            Solution solution{
+                AnytimeAStarSearch::reconstruct_path(graph, start, goal, state),
+                typename Graph::cost_t(0),
+                weight,
+                1.0,
+                expanded,
+                timer.duration()};
+
+            // parents of inconsistent locations may lead to a way cheaper than the cost saved at the goal
+            for (size_t step = 1; step < solution.path.size(); step++)
+            {
+                solution.cost += cost(solution.path[step - 1], solution.path[step]);
+            }
+
+            // a repaired way is not always cheaper, keep the cheapest path found so far
+            if (!solutions.empty() && solutions.back().cost <= solution.cost)
+            {
+                solution.path   = solutions.back().path;
+                solution.cost   = solutions.back().cost;
+                solution.weight = solutions.back().weight;
+            }
+
+            if (lower_bound > 0)
+            {
+                solution.bound = std::min(weight, (double)solution.cost / lower_bound);
+            }
+
+            // lower weight often finds the same path, it is reported again only with a tighter bound
+            if (solutions.empty() || solution.cost < solutions.back().cost || solution.bound < solutions.back().bound)
+            {
+                solutions.push_back(solution);
+
+                if (report)
+                {
+                    report(solutions.back());
+                }
+            }
+
+            if (solution.bound <= 1.0)
+            {
+                break; // path is the cheapest one
+            }
+
+            // repair the search with a lower weight
+            weight = std::max(1.0, weight - schedule.weight_step);
+            round++;
+
+            for (typename Graph::index_t index : open)
+            {
+                frontier.push(index, priority(index));
+            }
+        }
+
+        return solutions;
+    }
+
+    /**
+     * @brief Search paths from `start` to `goal`, each cheaper than the one
+     * before, in a graph
+     *
+     * @param graph - graph to search
+     * @param start
+     * @param goal
+     * @param heuristic - consistent heuristic to determine distance from the
+     * goal
+     * @param schedule - weights and limits of the search
+     * @param record - list of steps taken by the algorithm. Saves location
+     * (`Location`), time taken (`std::chrono::microseconds`), and a cost of
+     * location (`Graph::cost_t`)
+     *
+     * @return std::vector<Solution> - found paths, each cheaper than the one
+     * before, empty if no path was found within limits
+     */
+    static std::vector<Solution> search(
+        const Graph                                                                              &graph,
+        const typename Graph::Location                                                           &start,
+        const typename Graph::Location                                                           &goal,
+        std::function<typename Graph::cost_t(typename Graph::Location, typename Graph::Location)> heuristic,
+        const AnytimeSchedule                                                                    &schedule,
+        std::vector<typename Graph::ChangeRecord>                                                &record
+    )
+    {
+        return AnytimeAStarSearch::search(graph, start, goal, heuristic, GraphCost<Graph>{graph}, schedule, &record);
+    }
+};
@@ -1,39 +1,45 @@
 #pragma once
 
 #include <algorithm>
-#include <unordered_map>
 #include <vector>
 
+#include "data_structure/dense_search_state.h"
+#include "data_structure/parent_directions.h"
+
 template <typename Graph> class BasePathFinder
 {
   public:
     /**
      * @brief Reconstruct path from `start` to `goal`
      *
+     * @param graph - graph that was searched
      * @param start - start position
      * @param goal - end position
-     * @param came_from - map of ways to location
+     * @param state - search state with ways to each location
      *
      * @return std::vector<Location>
      */
     static std::vector<typename Graph::Location> reconstruct_path(
-        const typename Graph::Location                                         &start,
-        const typename Graph::Location                                         &goal,
-        std::unordered_map<typename Graph::Location, typename Graph::Location> &came_from
+        const Graph                    &graph,
+        const typename Graph::Location &start,
+        const typename Graph::Location &goal,
+        const DenseSearchState<Graph>  &state
     )
     {
         std::vector<typename Graph::Location> path;
-        typename Graph::Location              current = goal;
 
-        if (came_from.find(goal) == came_from.end())
+        typename Graph::index_t start_index = graph.index(start);
+        typename Graph::index_t current     = graph.index(goal);
+
+        if (!state.isVisited(current))
         {
             return path; // no path can be found
         }
 
-        while (current != start)
+        while (current != start_index)
         {
-            path.push_back(current);
-            current = came_from[current];
+            path.push_back(graph.location(current));
+            current = state.parent(current);
         }
 
         path.push_back(start);
@@ -43,4 +49,82 @@ template <typename Graph> class BasePathFinder
 
         return path;
     }
+
+    /**
+     * @brief Reconstruct path from `start` to `goal` into `path`. Length is
+     * counted first, so locations are written in order from `start` and
+     * memory already held by `path` is reused
+     *
+     * @param graph - grid that was searched
+     * @param start - start position
+     * @param goal - end position, must have been reached by the search
+     * @param parents - direction from each reached location to its parent
+     * @param path - replaced by the path from `start` to `goal`
+     */
+    static void reconstruct_path(
+        const Graph                           &graph,
+        const typename Graph::Location        &start,
+        const typename Graph::Location        &goal,
+        const ParentDirections<Graph>         &parents,
+        std::vector<typename Graph::Location> &path
+    )
+    {
+        auto parent = [&](const typename Graph::Location &location) {
+            const typename Graph::Location &step = Graph::directions[parents.direction(graph.index(location))];
+            return typename Graph::Location{location.x + step.x, location.y + step.y};
+        };
+
+        size_t length = 1;
+
+        for (typename Graph::Location current = goal; current != start; current = parent(current))
+        {
+            length++;
+        }
+
+        path.resize(length);
+        path[length - 1] = goal;
+
+        for (size_t step = length - 1; step > 0; step--)
+        {
+            path[step - 1] = parent(path[step]);
+        }
+    }
+
+    /**
+     * @brief Reconstruct path from `start` to `goal` found by two searches
+     * that met at `meeting`
+     *
+     * @param graph - graph that was searched
+     * @param start - start position
+     * @param goal - end position
+     * @param meeting - index of the location where searches met
+     * @param forward - search state of the search from `start`
+     * @param backward - search state of the search from `goal`
+     *
+     * @return std::vector<Location>
+     */
+    static std::vector<typename Graph::Location> reconstruct_bidirectional_path(
+        const Graph                    &graph,
+        const typename Graph::Location &start,
+        const typename Graph::Location &goal,
+        const typename Graph::index_t   meeting,
+        const DenseSearchState<Graph>  &forward,
+        const DenseSearchState<Graph>  &backward
+    )
+    {
+        std::vector<typename Graph::Location> path
+            = BasePathFinder::reconstruct_path(graph, start, graph.location(meeting), forward);
+
+        typename Graph::index_t goal_index = graph.index(goal);
+        typename Graph::index_t current    = meeting;
+
+        // backward search parents lead to the goal
+        while (current != goal_index)
+        {
+            current = backward.parent(current);
+            path.push_back(graph.location(current));
+        }
+
+        return path;
+    }
 };
@@ -0,0 +1,131 @@
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <vector>
+
+#include "data_structure/priority_queue.h"
+#include "data_structure/search_workspace.h"
+#include "utility/thread_pool.h"
+
+/**
+ * Pair of locations to find a path between
+ *
+ * @tparam Graph
+ */
+template <typename Graph> struct PathQuery
+{
+    typename Graph::Location start;
+    typename Graph::Location goal;
+};
+
+/**
+ * Solves many start and goal pairs on the same graph. Queries are handed out
+ * to workers one by one, so workers that got short queries take more of them.
+ * Every worker runs its queries in its own workspace, which is allocated once
+ * per batch and reused by every query of that worker.
+ *
+ * Graph is only read, so it must not change while the batch runs
+ *
+ * @tparam Graph
+ * @tparam Frontier - queue of location indices ordered by cost, one of
+ * `PriorityQueue`, `BucketQueue` or `IndexedHeap`
+ */
+template <typename Graph, typename Frontier = PriorityQueue<typename Graph::index_t, typename Graph::cost_t>>
+class BatchSearch
+{
+  public:
+    typedef SearchWorkspace<Graph, Frontier> Workspace;
+    typedef PathQuery<Graph>                 Query;
+
+    /**
+     * Pathfinder to solve a query with. Gets graph, start, goal, record that
+     * is `nullptr` if steps are not saved, and workspace of the worker
+     */
+    typedef std::function<std::vector<typename Graph::Location>(
+        const Graph &,
+        const typename Graph::Location &,
+        const typename Graph::Location &,
+        std::vector<typename Graph::ChangeRecord> *,
+        Workspace &
+    )>
+        Solver;
+
+    /**
+     * @brief Find paths of all `queries` in a graph
+     *
+     * @param graph - graph to search
+     * @param queries
+     * @param solver - pathfinder to run, must not use `pool`
+     * @param pool - workers to run queries on
+     * @param records - steps taken for every query, in order of `queries`.
+     * Not saved if `nullptr`
+     *
+     * @return std::vector<std::vector<Location>> - paths in order of `queries`
+     */
+    static std::vector<std::vector<typename Graph::Location>> search(
+        const Graph                                             &graph,
+        const std::vector<Query>                                &queries,
+        const Solver                                            &solver,
+        ThreadPool                                              &pool,
+        std::vector<std::vector<typename Graph::ChangeRecord>> *records = nullptr
+    )
+    {
+        std::vector<std::vector<typename Graph::Location>> paths(queries.size());
+
+        if (records != nullptr)
+        {
+            records->assign(queries.size(), {});
+        }
+
+        std::atomic<size_t> next_query(0);
+
+        pool.run([&](size_t) {
+            Workspace workspace(0); // sized by the first query
+
+            try
+            {
+                for (size_t query = next_query++; query < queries.size(); query = next_query++)
+                {
+                    paths[query] = solver(
+                        graph,
+                        queries[query].start,
+                        queries[query].goal,
+                        records == nullptr ? nullptr : &(*records)[query],
+                        workspace
+                    );
+                }
+            }
+            catch (...)
+            {
+                // stop other workers, pool rethrows on the calling thread
+                next_query = queries.size();
+                throw;
+            }
+        });
+
+        return paths;
+    }
+
+    /**
+     * @brief Find paths of all `queries` in a graph on a pool with a worker
+     * per core
+     *
+     * @param graph - graph to search
+     * @param queries
+     * @param solver - pathfinder to run
+     * @param records - steps taken for every query, in order of `queries`.
+     * Not saved if `nullptr`
+     *
+     * @return std::vector<std::vector<Location>> - paths in order of `queries`
+     */
+    static std::vector<std::vector<typename Graph::Location>> search(
+        const Graph                                             &graph,
+        const std::vector<Query>                                &queries,
+        const Solver                                            &solver,
+        std::vector<std::vector<typename Graph::ChangeRecord>> *records = nullptr
+    )
+    {
+        return BatchSearch::search(graph, queries, solver, ThreadPool::shared(), records);
+    }
+};
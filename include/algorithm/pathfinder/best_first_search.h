@@ -0,0 +1,201 @@
+#pragma once
+
+#include <limits>
+#include <vector>
+
+#include "algorithm/pathfinder/base_path_finder.h"
+#include "algorithm/pathfinder/search_policy.h"
+#include "data_structure/dense_search_state.h"
+#include "data_structure/priority_queue.h"
+#include "data_structure/search_workspace.h"
+#include "utility/recording.h"
+#include "utility/timer.h"
+
+/**
+ * Priorities decide the order in which `BestFirstSearch` expands locations.
+ * Every priority is a functor of the cost of the way to a location, the
+ * location and the goal, and has `is_reopening`, which tells if a location is
+ * pushed again when a cheaper way to it is found
+ */
+
+/**
+ * Cheapest way first, gives Dijkstra's algorithm
+ *
+ * @tparam Graph
+ */
+template <typename Graph> struct DijkstraPriority
+{
+    static constexpr bool is_reopening = true;
+
+    inline typename Graph::cost_t operator()(
+        const typename Graph::cost_t cost, const typename Graph::Location &, const typename Graph::Location &
+    ) const
+    {
+        return cost;
+    }
+};
+
+/**
+ * Cheapest estimated way through the location first, gives A*
+ *
+ * @tparam Graph
+ * @tparam Heuristic - functor of two locations, see `search_policy.h`
+ */
+template <typename Graph, typename Heuristic> struct AStarPriority
+{
+    static constexpr bool is_reopening = true;
+
+    const Heuristic &heuristic;
+
+    inline typename Graph::cost_t operator()(
+        const typename Graph::cost_t cost, const typename Graph::Location &next, const typename Graph::Location &goal
+    ) const
+    {
+        return cost + this->heuristic(next, goal);
+    }
+};
+
+/**
+ * Location estimated to be closest to the goal first, gives greedy best-first
+ * search. Way to a location is never improved, so paths are not the cheapest
+ *
+ * @tparam Graph
+ * @tparam Heuristic - functor of two locations, see `search_policy.h`
+ */
+template <typename Graph, typename Heuristic> struct GreedyPriority
+{
+    static constexpr bool is_reopening = false;
+
+    const Heuristic &heuristic;
+
+    inline typename Graph::cost_t operator()(
+        const typename Graph::cost_t, const typename Graph::Location &next, const typename Graph::Location &goal
+    ) const
+    {
+        return this->heuristic(next, goal);
+    }
+};
+
+/**
+ * Most expensive way first, gives depth-first search: neighbors of the last
+ * expanded location are always the deepest ones. Way to a location is never
+ * improved, so paths are not the cheapest
+ *
+ * @tparam Graph
+ */
+template <typename Graph> struct DepthFirstPriority
+{
+    static constexpr bool is_reopening = false;
+
+    inline typename Graph::cost_t operator()(
+        const typename Graph::cost_t cost, const typename Graph::Location &, const typename Graph::Location &
+    ) const
+    {
+        return std::numeric_limits<typename Graph::cost_t>::max() - cost;
+    }
+};
+
+/**
+ * Best-first search. Expands location with the lowest priority and pushes its
+ * neighbors, until the goal is expanded. Dijkstra, A*, greedy best-first and
+ * depth-first searches differ only by priority
+ *
+ * @tparam Graph
+ * @tparam Frontier - queue of location indices ordered by cost, one of
+ * `PriorityQueue`, `BucketQueue` or `IndexedHeap`. `BucketQueue` needs
+ * priorities that never decrease, as in Dijkstra and A* with a consistent
+ * heuristic
+ * @tparam Recording - which expansions are saved to the record, one of
+ * `FullRecording`, `SampledRecording` or `NoRecording`
+ */
+template <
+    typename Graph,
+    typename Frontier  = PriorityQueue<typename Graph::index_t, typename Graph::cost_t>,
+    typename Recording = FullRecording>
+class BestFirstSearch : BasePathFinder<Graph>
+{
+  public:
+    /**
+     * @brief Search a path from `start` to `goal` in a graph
+     *
+     * @tparam Priority - functor of cost, location and goal, see top of
+     * `best_first_search.h`
+     * @tparam Cost - functor of two locations, see `search_policy.h`
+     * @tparam Connectivity - functor of two locations that is false when no
+     * path between them exists, see `search_policy.h`
+     * @param graph - graph to search
+     * @param start
+     * @param goal
+     * @param priority - order of expansion
+     * @param cost - cost of a step between two neighbors
+     * @param record - list of steps taken by the algorithm. Saves location
+     * (`Location`), time taken (`std::chrono::microseconds`), and a cost of
+     * location (`Graph::cost_t`), not saved if `nullptr`
+     * @param workspace - memory of the search, reused between searches
+     * @param connectivity - checked before the search, so a goal that cannot
+     * be reached is rejected without expanding its whole area
+     *
+     * @return std::vector<Location> - path from `start` to `goal`
+     */
+    template <typename Priority, typename Cost, typename Connectivity = FullConnectivity<Graph>>
+    static std::vector<typename Graph::Location> search(
+        const Graph                               &graph,
+        const typename Graph::Location            &start,
+        const typename Graph::Location            &goal,
+        const Priority                            &priority,
+        const Cost                                &cost,
+        std::vector<typename Graph::ChangeRecord> *record,
+        SearchWorkspace<Graph, Frontier>          &workspace,
+        const Connectivity                        &connectivity = Connectivity()
+    )
+    {
+        if (!connectivity(start, goal))
+        {
+            return {}; // no path can be found
+        }
+
+        DenseSearchState<Graph> &state    = workspace.state;
+        Frontier                &frontier = workspace.frontier;
+
+        workspace.reset(graph.size());
+
+        typename Graph::index_t start_index = graph.index(start);
+        typename Graph::index_t goal_index  = graph.index(goal);
+
+        frontier.push(start_index, priority(typename Graph::cost_t(0), start, goal));
+        state.set(start_index, typename Graph::cost_t(0), start_index);
+
+        Timer     timer;
+        Recording recording;
+
+        while (!frontier.empty())
+        {
+            typename Graph::index_t  current_index = frontier.pop();
+            typename Graph::Location current       = graph.location(current_index);
+
+            if (record != nullptr && recording.take())
+            {
+                timer.tock();
+                record->push_back({current, timer.duration(), 0, state.cost(current_index)});
+            }
+
+            if (current_index == goal_index)
+            {
+                break;
+            }
+
+            for (const typename Graph::Location &next : graph.neighbors(current))
+            {
+                typename Graph::index_t next_index = graph.index(next);
+                typename Graph::cost_t  new_cost   = state.cost(current_index) + cost(current, next);
+                if (!state.isVisited(next_index) || (Priority::is_reopening && new_cost < state.cost(next_index)))
+                {
+                    state.set(next_index, new_cost, current_index);
+                    frontier.push(next_index, priority(new_cost, next, goal));
+                }
+            }
+        }
+
+        return BestFirstSearch::reconstruct_path(graph, start, goal, state);
+    }
+};
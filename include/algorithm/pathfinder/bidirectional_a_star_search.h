@@ -0,0 +1,205 @@
+#pragma once
+
+#include <functional>
+#include <limits>
+#include <vector>
+
+#include "algorithm/pathfinder/base_path_finder.h"
+#include "data_structure/bucket_queue.h"
+#include "data_structure/dense_search_state.h"
+#include "data_structure/indexed_heap.h"
+#include "data_structure/priority_queue.h"
+#include "utility/timer.h"
+
+/**
+ * Searches from `start` and from `goal` at the same time and stops when the
+ * two searches meet and no shorter path can be found.
+ *
+ * Both searches use the average of the two heuristics as a potential, so keys
+ * of both frontiers never decrease and a path through the meeting location is
+ * the shortest one. Keys are doubled to stay integer. Search with the smaller
+ * frontier is expanded first
+ *
+ * @tparam Graph
+ * @tparam Frontier - queue of location indices ordered by cost, one of
+ * `PriorityQueue`, `BucketQueue` or `IndexedHeap`
+ */
+template <typename Graph, typename Frontier = PriorityQueue<typename Graph::index_t, typename Graph::cost_t>>
+class BidirectionalAStarSearch : BasePathFinder<Graph>
+{
+  private:
+    /** One of the two searches */
+    struct Direction
+    {
+        DenseSearchState<Graph>  state;
+        Frontier                 frontier;
+        typename Graph::Location source;
+        typename Graph::Location target;
+
+        /** Lower bound of keys in the frontier */
+        typename Graph::cost_t bound = 0;
+
+        /** Amount of pushes not yet matched by pops, includes stale entries */
+        size_t queued = 0;
+    };
+
+    /**
+     * @brief Get frontier key of `location` reached with `cost` in `direction`
+     *
+     * @param direction
+     * @param location
+     * @param cost
+     * @param heuristic
+     * @param offset - heuristic from `start` to `goal`, keeps key non-negative
+     * @return Graph::cost_t
+     */
+    static typename Graph::cost_t key(
+        const Direction                                                                          &direction,
+        const typename Graph::Location                                                           &location,
+        const typename Graph::cost_t                                                              cost,
+        std::function<typename Graph::cost_t(typename Graph::Location, typename Graph::Location)> heuristic,
+        const typename Graph::cost_t                                                              offset
+    )
+    {
+        return 2 * cost + heuristic(location, direction.target) + offset - heuristic(location, direction.source);
+    }
+
+    /**
+     * @brief Expand one location of `side` and update the best path found
+     *
+     * @param graph
+     * @param side - direction to expand
+     * @param other - opposite direction
+     * @param heuristic
+     * @param offset
+     * @param best_cost - cost of the best path found
+     * @param meeting - index of the location where best path meets
+     * @param record
+     * @param timer
+     */
+    static void expand(
+        const Graph                                                                              &graph,
+        Direction                                                                                &side,
+        const Direction                                                                          &other,
+        std::function<typename Graph::cost_t(typename Graph::Location, typename Graph::Location)> heuristic,
+        const typename Graph::cost_t                                                              offset,
+        typename Graph::cost_t                                                                   &best_cost,
+        typename Graph::index_t                                                                  &meeting,
+        std::vector<typename Graph::ChangeRecord>                                                &record,
+        Timer<>                                                                                  &timer
+    )
+    {
+        typename Graph::index_t  current_index = side.frontier.pop();
+        side.queued--;
+        typename Graph::Location current       = graph.location(current_index);
+
+        timer.tock();
+        record.push_back({current, timer.duration(), 0, side.state.cost(current_index)});
+
+        // popped key may be stale, the current one is never greater
+        side.bound = key(side, current, side.state.cost(current_index), heuristic, offset);
+
+        for (const typename Graph::Location &next : graph.neighbors(current))
+        {
+            typename Graph::index_t next_index = graph.index(next);
+            typename Graph::cost_t  new_cost   = side.state.cost(current_index) + graph.cost(current, next);
+            if (!side.state.isVisited(next_index) || new_cost < side.state.cost(next_index))
+            {
+                side.state.set(next_index, new_cost, current_index);
+                side.frontier.push(next_index, key(side, next, new_cost, heuristic, offset));
+                side.queued++;
+            }
+
+            if (other.state.isVisited(next_index)
+                && side.state.cost(next_index) + other.state.cost(next_index) < best_cost)
+            {
+                best_cost = side.state.cost(next_index) + other.state.cost(next_index);
+                meeting   = next_index;
+            }
+        }
+    }
+
+  public:
+    /**
+     * @brief Search a path from `start` to `goal` in a graph
+     *
+     * @param graph - graph to search
+     * @param start
+     * @param goal
+     * @param heuristic - consistent heuristic to determine distance between
+     * locations
+     * @param record - list of steps taken by both searches. Saves location
+     * (`Location`), time taken (`std::chrono::microseconds`), and a cost of
+     * location (`Graph::cost_t`) from the side that reached it. Last step is
+     * the meeting location with a cost of the whole path
+     *
+     * @return std::vector<Location> - path from `start` to `goal`
+     */
+    static std::vector<typename Graph::Location> search(
+        const Graph                                                                              &graph,
+        const typename Graph::Location                                                           &start,
+        const typename Graph::Location                                                           &goal,
+        std::function<typename Graph::cost_t(typename Graph::Location, typename Graph::Location)> heuristic,
+        std::vector<typename Graph::ChangeRecord>                                                &record
+    )
+    {
+        Direction forward{DenseSearchState<Graph>(graph.size()), Frontier(), start, goal};
+        Direction backward{DenseSearchState<Graph>(graph.size()), Frontier(), goal, start};
+
+        typename Graph::index_t start_index = graph.index(start);
+        typename Graph::index_t goal_index  = graph.index(goal);
+        typename Graph::cost_t  offset      = heuristic(start, goal);
+
+        typename Graph::cost_t  best_cost = std::numeric_limits<typename Graph::cost_t>::max();
+        typename Graph::index_t meeting   = DenseSearchState<Graph>::NONE;
+
+        forward.state.set(start_index, typename Graph::cost_t(0), start_index);
+        forward.bound = key(forward, start, typename Graph::cost_t(0), heuristic, offset);
+        forward.frontier.push(start_index, forward.bound);
+        forward.queued++;
+
+        backward.state.set(goal_index, typename Graph::cost_t(0), goal_index);
+        backward.bound = key(backward, goal, typename Graph::cost_t(0), heuristic, offset);
+        backward.frontier.push(goal_index, backward.bound);
+        backward.queued++;
+
+        if (start_index == goal_index)
+        {
+            best_cost = 0;
+            meeting   = start_index;
+        }
+
+        Timer timer;
+
+        while (!forward.frontier.empty() && !backward.frontier.empty())
+        {
+            // no path through the frontiers can be shorter than the best one
+            if (meeting != DenseSearchState<Graph>::NONE && forward.bound + backward.bound >= 2 * (best_cost + offset))
+            {
+                break;
+            }
+
+            // grow the side with the smaller frontier
+            if (forward.queued <= backward.queued)
+            {
+                expand(graph, forward, backward, heuristic, offset, best_cost, meeting, record, timer);
+            }
+            else
+            {
+                expand(graph, backward, forward, heuristic, offset, best_cost, meeting, record, timer);
+            }
+        }
+
+        if (meeting == DenseSearchState<Graph>::NONE)
+        {
+            return std::vector<typename Graph::Location>();
+        }
+
+        timer.tock();
+        record.push_back({graph.location(meeting), timer.duration(), 0, best_cost});
+
+        return BidirectionalAStarSearch::reconstruct_bidirectional_path(
+            graph, start, goal, meeting, forward.state, backward.state
+        );
+    }
+};
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <vector>
+
+#include "algorithm/pathfinder/base_path_finder.h"
+#include "algorithm/pathfinder/bidirectional_a_star_search.h"
+#include "data_structure/priority_queue.h"
+
+/**
+ * Searches from `start` and from `goal` at the same time, same as
+ * `BidirectionalAStarSearch` without a heuristic
+ *
+ * @tparam Graph
+ * @tparam Frontier - queue of location indices ordered by cost, one of
+ * `PriorityQueue`, `BucketQueue` or `IndexedHeap`
+ */
+template <typename Graph, typename Frontier = PriorityQueue<typename Graph::index_t, typename Graph::cost_t>>
+class BidirectionalDijkstraSearch : BasePathFinder<Graph>
+{
+  private:
+  public:
+    /**
+     * @brief Search a path from `start` to `goal` in a graph
+     *
+     * @param graph - graph to search
+     * @param start
+     * @param goal
+     * @param record - list of steps taken by both searches. Saves location
+     * (`Location`), time taken (`std::chrono::microseconds`), and a cost of
+     * location (`Graph::cost_t`) from the side that reached it. Last step is
+     * the meeting location with a cost of the whole path
+     *
+     * @return std::vector<Location> - path from `start` to `goal`
+     */
+    static std::vector<typename Graph::Location> search(
+        const Graph                               &graph,
+        const typename Graph::Location            &start,
+        const typename Graph::Location            &goal,
+        std::vector<typename Graph::ChangeRecord> &record
+    )
+    {
+        return BidirectionalAStarSearch<Graph, Frontier>::search(
+            graph,
+            start,
+            goal,
+            [](typename Graph::Location, typename Graph::Location) { return typename Graph::cost_t(0); },
+            record
+        );
+    }
+};
@@ -0,0 +1,360 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "algorithm/pathfinder/base_path_finder.h"
+#include "data_structure/dense_search_state.h"
+#include "data_structure/parent_directions.h"
+#include "utility/timer.h"
+
+/**
+ * Breadth-first search for grids with uniform cost. Frontier and visited set
+ * are bitsets with the same layout as the packed cells of the grid, so every
+ * wavefront step moves whole 64-cell words with shifts and masks.
+ *
+ * Only words that have frontier cells are processed, so a step costs as much
+ * as the wavefront, not as the whole grid. When only the path is needed, each
+ * reached cell keeps the 2-bit direction to its parent instead of a distance
+ *
+ * @tparam Graph - grid with row-major bit mask `cells` padded to `row_words`
+ * words per row
+ */
+template <typename Graph> class BreadthFirstSearch : BasePathFinder<Graph>
+{
+  private:
+    /**
+     * @brief Add `bits` to candidates of the word with `index`
+     *
+     * @param candidates
+     * @param touched - indexes of words that have candidates
+     * @param index
+     * @param bits
+     */
+    static inline void addCandidates(
+        std::vector<uint64_t> &candidates, std::vector<size_t> &touched, const size_t index, const uint64_t bits
+    )
+    {
+        if (bits == 0)
+        {
+            return;
+        }
+
+        if (candidates[index] == 0)
+        {
+            touched.push_back(index);
+        }
+
+        candidates[index] |= bits;
+    }
+
+    /**
+     * @brief Expand wavefront from `start` until `goal_index` is reached or
+     * every reachable location is visited
+     *
+     * @param graph
+     * @param start
+     * @param goal_index - `DenseSearchState<Graph>::NONE` to visit every
+     * reachable location
+     * @param distances - distance of every visited location from `start`, not
+     * saved if `nullptr`
+     * @param parents - direction from every visited location to a location one
+     * step closer to `start`, not saved if `nullptr`
+     * @param record - visited locations, not saved if `nullptr`
+     * @return true - if `goal_index` was reached
+     * @return false
+     */
+    static bool expand(
+        const Graph                               &graph,
+        const typename Graph::Location            &start,
+        const typename Graph::index_t              goal_index,
+        std::vector<typename Graph::cost_t>       *distances,
+        ParentDirections<Graph>                   *parents,
+        std::vector<typename Graph::ChangeRecord> *record
+    )
+    {
+        const size_t row_words = graph.row_words;
+        const size_t words     = row_words * graph.height;
+
+        if (distances != nullptr)
+        {
+            distances->assign(graph.size(), BreadthFirstSearch::UNREACHABLE);
+        }
+
+        std::vector<uint64_t> visited(words, 0);
+        std::vector<uint64_t> candidates(words, 0);
+        std::vector<size_t>   touched;
+
+        // frontier words in grid layout, so parents of new cells are found with shifts
+        std::vector<uint64_t> layer(parents != nullptr ? words : 0, 0);
+
+        size_t   goal_word = 0;
+        uint64_t goal_bit  = 0;
+
+        if (goal_index != DenseSearchState<Graph>::NONE)
+        {
+            typename Graph::Location goal = graph.location(goal_index);
+
+            goal_word = goal.y * row_words + (goal.x >> 6);
+            goal_bit  = uint64_t(1) << (goal.x & 63);
+        }
+
+        // words with frontier cells and their frontier bits
+        std::vector<std::pair<size_t, uint64_t>> frontier;
+        std::vector<std::pair<size_t, uint64_t>> next_frontier;
+
+        size_t   start_word = start.y * row_words + (start.x >> 6);
+        uint64_t start_bit  = uint64_t(1) << (start.x & 63);
+
+        visited[start_word] = start_bit;
+        frontier.push_back({start_word, start_bit});
+        if (distances != nullptr)
+        {
+            (*distances)[graph.index(start)] = 0;
+        }
+
+        Timer timer;
+
+        if (record != nullptr)
+        {
+            timer.tock();
+            record->push_back({start, timer.duration(), 0, 0});
+        }
+
+        typename Graph::cost_t distance = 0;
+
+        bool is_goal_reached = (visited[goal_word] & goal_bit) != 0;
+
+        while (!frontier.empty() && !is_goal_reached)
+        {
+            distance++;
+            touched.clear();
+
+            if (parents != nullptr)
+            {
+                for (const std::pair<size_t, uint64_t> &word : frontier)
+                {
+                    layer[word.first] = word.second;
+                }
+            }
+
+            for (const std::pair<size_t, uint64_t> &word : frontier)
+            {
+                size_t   index = word.first;
+                uint64_t bits  = word.second;
+                size_t   x     = index % row_words;
+
+                // east and west inside the word, carry over word boundary
+                addCandidates(candidates, touched, index, (bits << 1) | (bits >> 1));
+
+                if (x + 1 < row_words)
+                {
+                    addCandidates(candidates, touched, index + 1, bits >> 63);
+                }
+
+                if (x > 0)
+                {
+                    addCandidates(candidates, touched, index - 1, bits << 63);
+                }
+
+                // north and south
+                if (index >= row_words)
+                {
+                    addCandidates(candidates, touched, index - row_words, bits);
+                }
+
+                if (index + row_words < words)
+                {
+                    addCandidates(candidates, touched, index + row_words, bits);
+                }
+            }
+
+            next_frontier.clear();
+
+            // whole wavefront is visited at once, so it shares the time
+            timer.tock();
+
+            for (size_t index : touched)
+            {
+                // padding bits are never passable, so shifts into them are dropped
+                uint64_t bits     = candidates[index] & graph.cells[index] & ~visited[index];
+                candidates[index] = 0;
+
+                if (bits == 0)
+                {
+                    continue;
+                }
+
+                visited[index] |= bits;
+                next_frontier.push_back({index, bits});
+
+                size_t y = index / row_words;
+                size_t x = (index % row_words) * 64;
+
+                // cells reached from each side, a cell reached from several takes any of them
+                uint64_t from_west  = 0;
+                uint64_t from_north = 0;
+                uint64_t from_south = 0;
+
+                if (parents != nullptr)
+                {
+                    from_west  = (layer[index] << 1) | (x > 0 ? layer[index - 1] >> 63 : 0);
+                    from_north = index >= row_words ? layer[index - row_words] : 0;
+                    from_south = index + row_words < words ? layer[index + row_words] : 0;
+                }
+
+                for (uint64_t rest = bits; rest != 0; rest &= rest - 1)
+                {
+                    typename Graph::Location location{(int)(x + __builtin_ctzll(rest)), (int)y};
+
+                    if (distances != nullptr)
+                    {
+                        (*distances)[graph.index(location)] = distance;
+                    }
+
+                    if (parents != nullptr)
+                    {
+                        uint64_t bit = rest & -rest;
+
+                        // indices of west, north, south and east in `Graph::directions`
+                        parents->set(
+                            graph.index(location),
+                            (from_west & bit) != 0    ? 1
+                            : (from_north & bit) != 0 ? 2
+                            : (from_south & bit) != 0 ? 3
+                                                      : 0
+                        );
+                    }
+
+                    if (record != nullptr)
+                    {
+                        record->push_back({location, timer.duration(), 0, distance});
+                    }
+                }
+            }
+
+            if (parents != nullptr)
+            {
+                for (const std::pair<size_t, uint64_t> &word : frontier)
+                {
+                    layer[word.first] = 0;
+                }
+            }
+
+            frontier.swap(next_frontier);
+
+            is_goal_reached = (visited[goal_word] & goal_bit) != 0;
+        }
+
+        return is_goal_reached;
+    }
+
+  public:
+    /** Distance of a location that cannot be reached */
+    static constexpr typename Graph::cost_t UNREACHABLE = std::numeric_limits<typename Graph::cost_t>::max();
+
+    /**
+     * @brief Search a path from `start` to `goal` in a graph
+     *
+     * @param graph - graph to search
+     * @param start
+     * @param goal
+     * @param record - list of steps taken by the algorithm. Saves location
+     * (`Location`), time taken (`std::chrono::microseconds`), and a cost of
+     * location (`Graph::cost_t`)
+     * @param distances - distance of every location from `start`, locations
+     * farther than `goal` are `UNREACHABLE`
+     *
+     * @return std::vector<Location> - path from `start` to `goal`
+     */
+    static std::vector<typename Graph::Location> search(
+        const Graph                               &graph,
+        const typename Graph::Location            &start,
+        const typename Graph::Location            &goal,
+        std::vector<typename Graph::ChangeRecord> &record,
+        std::vector<typename Graph::cost_t>       &distances
+    )
+    {
+        std::vector<typename Graph::Location> path;
+
+        typename Graph::index_t goal_index = graph.index(goal);
+
+        if (!BreadthFirstSearch::expand(graph, start, goal_index, &distances, nullptr, &record))
+        {
+            return path; // no path can be found
+        }
+
+        // walk back to the neighbor that is one step closer to the start
+        typename Graph::Location current = goal;
+
+        path.push_back(current);
+
+        while (current != start)
+        {
+            for (const typename Graph::Location &next : graph.neighbors(current))
+            {
+                if (distances[graph.index(next)] + 1 == distances[graph.index(current)])
+                {
+                    current = next;
+                    break;
+                }
+            }
+
+            path.push_back(current);
+        }
+
+        std::reverse(path.begin(), path.end());
+
+        return path;
+    }
+
+    /**
+     * @brief Search a path from `start` to `goal` in a graph
+     *
+     * @param graph - graph to search
+     * @param start
+     * @param goal
+     * @param record - list of steps taken by the algorithm. Saves location
+     * (`Location`), time taken (`std::chrono::microseconds`), and a cost of
+     * location (`Graph::cost_t`)
+     *
+     * @return std::vector<Location> - path from `start` to `goal`
+     */
+    static std::vector<typename Graph::Location> search(
+        const Graph                               &graph,
+        const typename Graph::Location            &start,
+        const typename Graph::Location            &goal,
+        std::vector<typename Graph::ChangeRecord> &record
+    )
+    {
+        std::vector<typename Graph::Location> path;
+
+        // only the path is returned, so 2 bits of parent direction replace a distance per location
+        ParentDirections<Graph> parents(graph.size());
+
+        if (BreadthFirstSearch::expand(graph, start, graph.index(goal), nullptr, &parents, &record))
+        {
+            BreadthFirstSearch::reconstruct_path(graph, start, goal, parents, path);
+        }
+
+        return path;
+    }
+
+    /**
+     * @brief Get distance from `start` to every location of a graph
+     *
+     * @param graph
+     * @param start
+     * @return std::vector<Graph::cost_t> - distances by location index,
+     * `UNREACHABLE` if location cannot be reached
+     */
+    static std::vector<typename Graph::cost_t> distances(const Graph &graph, const typename Graph::Location &start)
+    {
+        std::vector<typename Graph::cost_t> distances;
+        BreadthFirstSearch::expand(graph, start, DenseSearchState<Graph>::NONE, &distances, nullptr, nullptr);
+        return distances;
+    }
+};
@@ -0,0 +1,298 @@
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "data_structure/priority_queue.h"
+#include "utility/timer.h"
+
+/**
+ * Incremental planner (D* Lite). Searches from `goal` to `start` and keeps
+ * costs of the search between calls. After cells change, only locations
+ * whose cost to the goal is affected are expanded again. `start` can move
+ * along the path without restarting the search.
+ *
+ * With fixed `start` it is Lifelong Planning A* (LPA*) searching backwards
+ *
+ * @tparam Graph
+ */
+template <typename Graph> class DStarLiteSearch
+{
+  public:
+    /** Cost of a location that cannot reach the goal */
+    static constexpr typename Graph::cost_t UNREACHABLE = std::numeric_limits<typename Graph::cost_t>::max();
+
+    /**
+     * @brief Construct a new D* Lite Search object, does not search yet
+     *
+     * @param graph - graph to search, is kept by reference
+     * @param start
+     * @param goal
+     * @param heuristic - consistent heuristic to determine distance between
+     * locations
+     */
+    DStarLiteSearch(
+        const Graph                                                                              &graph,
+        const typename Graph::Location                                                           &start,
+        const typename Graph::Location                                                           &goal,
+        std::function<typename Graph::cost_t(typename Graph::Location, typename Graph::Location)> heuristic
+    )
+        : graph(graph),
+          start(start),
+          last_start(start),
+          goal(goal),
+          heuristic(heuristic),
+          costs(graph.size(), UNREACHABLE),
+          lookahead(graph.size(), UNREACHABLE)
+    {
+        typename Graph::index_t goal_index = graph.index(goal);
+
+        this->lookahead[goal_index] = 0;
+        this->queue.push(goal_index, this->key(goal_index));
+    }
+
+    /**
+     * @brief Find a path from `start` to `goal`, reusing costs of previous
+     * searches
+     *
+     * @param record - list of locations expanded by this call. Saves location
+     * (`Location`), time taken (`std::chrono::microseconds`), and a cost of
+     * location to the goal (`Graph::cost_t`)
+     *
+     * @return std::vector<Location> - path from `start` to `goal`
+     */
+    std::vector<typename Graph::Location> search(std::vector<typename Graph::ChangeRecord> &record)
+    {
+        typename Graph::index_t start_index = this->graph.index(this->start);
+
+        Timer timer;
+
+        while (!this->queue.empty()
+               && (this->queue.topPriority() < this->key(start_index)
+                   || this->lookahead[start_index] != this->costs[start_index]))
+        {
+            Key                     old_key = this->queue.topPriority();
+            typename Graph::index_t current = this->queue.pop();
+
+            // location was already made consistent by a newer entry
+            if (this->costs[current] == this->lookahead[current])
+            {
+                continue;
+            }
+
+            Key new_key = this->key(current);
+
+            if (old_key < new_key)
+            {
+                this->queue.push(current, new_key);
+                continue;
+            }
+
+            timer.tock();
+            record.push_back(
+                {this->graph.location(current),
+                 timer.duration(),
+                 0,
+                 std::min(this->costs[current], this->lookahead[current])}
+            );
+
+            if (this->costs[current] > this->lookahead[current])
+            {
+                this->costs[current] = this->lookahead[current];
+            }
+            else
+            {
+                this->costs[current] = UNREACHABLE;
+                this->updateLocation(current);
+            }
+
+            this->updateNeighbors(this->graph.location(current));
+        }
+
+        return this->path();
+    }
+
+    /**
+     * @brief Update costs around `changed` cells, next `search` repairs
+     * the path
+     *
+     * @param changed - locations of cells that were changed, as returned by
+     * `Grid::apply`
+     */
+    void update(const std::vector<typename Graph::Location> &changed)
+    {
+        for (const typename Graph::Location &location : changed)
+        {
+            this->updateLocation(this->graph.index(location));
+            this->updateNeighbors(location);
+        }
+    }
+
+    /**
+     * @brief Move start to `location`, usually the next location of the path
+     *
+     * @param location
+     */
+    void move(const typename Graph::Location &location)
+    {
+        this->start = location;
+
+        // keys of queued locations are lower bounds now, so they are not recomputed
+        this->key_modifier += this->heuristic(this->last_start, this->start);
+        this->last_start = this->start;
+    }
+
+  private:
+    /** Priority of a location: cost with heuristic, then cost */
+    typedef std::pair<typename Graph::cost_t, typename Graph::cost_t> Key;
+
+    const Graph &graph;
+
+    typename Graph::Location start;
+    typename Graph::Location last_start;
+    typename Graph::Location goal;
+
+    std::function<typename Graph::cost_t(typename Graph::Location, typename Graph::Location)> heuristic;
+
+    /** Cost of every location to the goal found by the last expansion */
+    std::vector<typename Graph::cost_t> costs;
+
+    /** Cost of every location to the goal through its best neighbor */
+    std::vector<typename Graph::cost_t> lookahead;
+
+    PriorityQueue<typename Graph::index_t, Key> queue;
+
+    typename Graph::cost_t key_modifier = 0;
+
+    /**
+     * @brief Add costs without overflowing `UNREACHABLE`
+     *
+     * @param lhs
+     * @param rhs
+     * @return Graph::cost_t
+     */
+    static inline typename Graph::cost_t add(const typename Graph::cost_t lhs, const typename Graph::cost_t rhs)
+    {
+        return lhs == UNREACHABLE || rhs == UNREACHABLE ? UNREACHABLE : lhs + rhs;
+    }
+
+    /**
+     * @brief Get priority of location with `index`
+     *
+     * @param index
+     * @return Key
+     */
+    inline Key key(const typename Graph::index_t index) const
+    {
+        typename Graph::cost_t cost = std::min(this->costs[index], this->lookahead[index]);
+
+        return {
+            DStarLiteSearch::add(
+                cost, this->heuristic(this->start, this->graph.location(index)) + this->key_modifier
+            ),
+            cost};
+    }
+
+    /**
+     * @brief Recompute lookahead cost of location with `index` and queue it
+     * if it is inconsistent
+     *
+     * @param index
+     */
+    void updateLocation(const typename Graph::index_t index)
+    {
+        typename Graph::Location location = this->graph.location(index);
+
+        if (location != this->goal)
+        {
+            typename Graph::cost_t best = UNREACHABLE;
+
+            if (this->graph.isPassable(location))
+            {
+                for (const typename Graph::Location &next : this->graph.neighbors(location))
+                {
+                    typename Graph::cost_t cost
+                        = DStarLiteSearch::add(this->graph.cost(location, next), this->costs[this->graph.index(next)]);
+
+                    best = std::min(best, cost);
+                }
+            }
+
+            this->lookahead[index] = best;
+        }
+
+        if (this->costs[index] != this->lookahead[index])
+        {
+            this->queue.push(index, this->key(index));
+        }
+    }
+
+    /**
+     * @brief Update every in-bounds neighbor of `location`, passable or not
+     *
+     * @param location
+     */
+    void updateNeighbors(const typename Graph::Location &location)
+    {
+        for (const typename Graph::Location &direction : Graph::directions)
+        {
+            typename Graph::Location next{location.x + direction.x, location.y + direction.y};
+
+            if (this->graph.isInBounds(next))
+            {
+                this->updateLocation(this->graph.index(next));
+            }
+        }
+    }
+
+    /**
+     * @brief Follow the cheapest neighbors from `start` to `goal`
+     *
+     * @return std::vector<Location>
+     */
+    std::vector<typename Graph::Location> path() const
+    {
+        std::vector<typename Graph::Location> path;
+
+        if (this->costs[this->graph.index(this->start)] == UNREACHABLE)
+        {
+            return path; // no path can be found
+        }
+
+        typename Graph::Location current = this->start;
+
+        path.push_back(current);
+
+        while (current != this->goal)
+        {
+            typename Graph::Location best      = current;
+            typename Graph::cost_t   best_cost = UNREACHABLE;
+
+            for (const typename Graph::Location &next : this->graph.neighbors(current))
+            {
+                typename Graph::cost_t cost
+                    = DStarLiteSearch::add(this->graph.cost(current, next), this->costs[this->graph.index(next)]);
+
+                if (cost < best_cost)
+                {
+                    best      = next;
+                    best_cost = cost;
+                }
+            }
+
+            // guard against a loop if costs are not repaired yet
+            if (best_cost == UNREACHABLE || path.size() > this->graph.size())
+            {
+                return std::vector<typename Graph::Location>();
+            }
+
+            current = best;
+            path.push_back(current);
+        }
+
+        return path;
+    }
+};
@@ -0,0 +1,341 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "algorithm/pathfinder/base_path_finder.h"
+#include "utility/thread_pool.h"
+#include "utility/timer.h"
+
+/**
+ * Delta-stepping shortest path. Locations are kept in buckets of width
+ * `delta` by their tentative cost. Every bucket is settled by relaxing light
+ * edges (cost up to `delta`) of its locations in parallel until it stays
+ * empty, then heavy edges of every location removed from it are relaxed once.
+ *
+ * Costs are updated with atomic minimum, so workers do not lock. Small
+ * buckets are relaxed by the calling thread only, synchronizing workers
+ * costs more than relaxing them
+ *
+ * @tparam Graph
+ */
+template <typename Graph> class DeltaSteppingSearch : BasePathFinder<Graph>
+{
+  private:
+    /** Buckets smaller than this are relaxed by the calling thread */
+    static const size_t PARALLEL_THRESHOLD = 1024;
+
+    /**
+     * @brief Relax light or heavy edges of `requests` in parallel
+     *
+     * @param graph
+     * @param requests
+     * @param costs
+     * @param delta
+     * @param is_light - relax light edges if true, heavy otherwise
+     * @param pool
+     * @param improved - locations with lower cost, one list per worker
+     */
+    static void relax(
+        const Graph                                      &graph,
+        const std::vector<typename Graph::index_t>       &requests,
+        std::vector<std::atomic<typename Graph::cost_t>> &costs,
+        const typename Graph::cost_t                      delta,
+        const bool                                        is_light,
+        ThreadPool                                       &pool,
+        std::vector<std::vector<typename Graph::index_t>> &improved
+    )
+    {
+        size_t workers = requests.size() < DeltaSteppingSearch::PARALLEL_THRESHOLD ? 1 : pool.size();
+
+        auto task = [&](size_t worker) {
+            size_t begin = requests.size() * worker / workers;
+            size_t end   = requests.size() * (worker + 1) / workers;
+
+            for (size_t i = begin; i < end; i++)
+            {
+                typename Graph::Location current = graph.location(requests[i]);
+                typename Graph::cost_t   cost    = costs[requests[i]].load(std::memory_order_relaxed);
+
+                for (const typename Graph::Location &next : graph.neighbors(current))
+                {
+                    typename Graph::cost_t edge_cost = graph.cost(current, next);
+
+                    if ((edge_cost <= delta) != is_light)
+                    {
+                        continue;
+                    }
+
+                    typename Graph::index_t next_index = graph.index(next);
+                    typename Graph::cost_t  new_cost   = cost + edge_cost;
+                    typename Graph::cost_t  old_cost   = costs[next_index].load(std::memory_order_relaxed);
+
+                    while (new_cost < old_cost)
+                    {
+                        if (costs[next_index].compare_exchange_weak(old_cost, new_cost, std::memory_order_relaxed))
+                        {
+                            improved[worker].push_back(next_index);
+                            break;
+                        }
+                    }
+                }
+            }
+        };
+
+        if (workers == 1)
+        {
+            task(0);
+        }
+        else
+        {
+            pool.run(task);
+        }
+    }
+
+    /**
+     * @brief Settle buckets until `goal_index` is settled or every reachable
+     * location is settled
+     *
+     * @param graph
+     * @param start
+     * @param goal_index - `DenseSearchState<Graph>::NONE` to settle every
+     * reachable location
+     * @param delta
+     * @param pool
+     * @param record - settled locations, not saved if `nullptr`
+     * @return std::vector<Graph::cost_t> - costs by location index
+     */
+    static std::vector<typename Graph::cost_t> expand(
+        const Graph                               &graph,
+        const typename Graph::Location            &start,
+        const typename Graph::index_t              goal_index,
+        const typename Graph::cost_t               delta,
+        ThreadPool                                &pool,
+        std::vector<typename Graph::ChangeRecord> *record
+    )
+    {
+        if (delta == 0)
+        {
+            throw std::invalid_argument("Argument exception: Cannot run delta-stepping. Delta must be greater than 0.");
+        }
+
+        std::vector<std::atomic<typename Graph::cost_t>> costs(graph.size());
+
+        for (std::atomic<typename Graph::cost_t> &cost : costs)
+        {
+            cost.store(DeltaSteppingSearch::UNREACHABLE, std::memory_order_relaxed);
+        }
+
+        // cost with which location was last relaxed, filters duplicates
+        std::vector<typename Graph::cost_t> relaxed(graph.size(), DeltaSteppingSearch::UNREACHABLE);
+
+        std::vector<std::vector<typename Graph::index_t>> buckets(1);
+        std::vector<std::vector<typename Graph::index_t>> improved(pool.size());
+        std::vector<typename Graph::index_t>              requests;
+        std::vector<typename Graph::index_t>              settled;
+
+        typename Graph::index_t start_index = graph.index(start);
+
+        costs[start_index].store(0, std::memory_order_relaxed);
+        buckets[0].push_back(start_index);
+
+        // put improved locations into buckets by their cost
+        auto distribute = [&]() {
+            for (std::vector<typename Graph::index_t> &list : improved)
+            {
+                for (typename Graph::index_t index : list)
+                {
+                    size_t bucket = costs[index].load(std::memory_order_relaxed) / delta;
+
+                    if (bucket >= buckets.size())
+                    {
+                        buckets.resize(bucket + 1);
+                    }
+
+                    buckets[bucket].push_back(index);
+                }
+
+                list.clear();
+            }
+        };
+
+        Timer timer;
+
+        for (size_t bucket = 0; bucket < buckets.size(); bucket++)
+        {
+            settled.clear();
+
+            while (!buckets[bucket].empty())
+            {
+                requests.clear();
+
+                for (typename Graph::index_t index : buckets[bucket])
+                {
+                    typename Graph::cost_t cost = costs[index].load(std::memory_order_relaxed);
+
+                    // location was moved to a lower bucket or already relaxed with this cost
+                    if (cost / delta != bucket || cost == relaxed[index])
+                    {
+                        continue;
+                    }
+
+                    // location is settled in the first bucket it is relaxed in
+                    if (relaxed[index] == DeltaSteppingSearch::UNREACHABLE)
+                    {
+                        settled.push_back(index);
+                    }
+
+                    relaxed[index] = cost;
+                    requests.push_back(index);
+                }
+
+                buckets[bucket].clear();
+
+                DeltaSteppingSearch::relax(graph, requests, costs, delta, true, pool, improved);
+                distribute();
+            }
+
+            DeltaSteppingSearch::relax(graph, settled, costs, delta, false, pool, improved);
+            distribute();
+
+            if (record != nullptr)
+            {
+                timer.tock();
+
+                for (typename Graph::index_t index : settled)
+                {
+                    record->push_back({graph.location(index), timer.duration(), 0, relaxed[index]});
+                }
+            }
+
+            if (goal_index != DenseSearchState<Graph>::NONE
+                && costs[goal_index].load(std::memory_order_relaxed) / delta <= bucket)
+            {
+                break;
+            }
+
+            std::vector<typename Graph::index_t>().swap(buckets[bucket]);
+        }
+
+        std::vector<typename Graph::cost_t> result(graph.size());
+
+        for (size_t index = 0; index < result.size(); index++)
+        {
+            result[index] = costs[index].load(std::memory_order_relaxed);
+        }
+
+        return result;
+    }
+
+  public:
+    /** Cost of a location that cannot be reached */
+    static constexpr typename Graph::cost_t UNREACHABLE = std::numeric_limits<typename Graph::cost_t>::max();
+
+    /**
+     * @brief Search a path from `start` to `goal` in a graph
+     *
+     * @param graph - graph to search
+     * @param start
+     * @param goal
+     * @param record - list of settled locations, bucket by bucket. Saves
+     * location (`Location`), time taken (`std::chrono::microseconds`), and a
+     * cost of location (`Graph::cost_t`)
+     * @param pool - workers to relax edges on
+     * @param delta - width of a bucket
+     *
+     * @return std::vector<Location> - path from `start` to `goal`
+     */
+    static std::vector<typename Graph::Location> search(
+        const Graph                               &graph,
+        const typename Graph::Location            &start,
+        const typename Graph::Location            &goal,
+        std::vector<typename Graph::ChangeRecord> &record,
+        ThreadPool                                &pool,
+        const typename Graph::cost_t               delta = 1
+    )
+    {
+        std::vector<typename Graph::Location> path;
+
+        typename Graph::index_t goal_index = graph.index(goal);
+
+        std::vector<typename Graph::cost_t> costs
+            = DeltaSteppingSearch::expand(graph, start, goal_index, delta, pool, &record);
+
+        if (costs[goal_index] == DeltaSteppingSearch::UNREACHABLE)
+        {
+            return path; // no path can be found
+        }
+
+        // walk back to the neighbor that lies on a shortest path
+        typename Graph::Location current = goal;
+
+        path.push_back(current);
+
+        while (current != start)
+        {
+            for (const typename Graph::Location &next : graph.neighbors(current))
+            {
+                typename Graph::cost_t next_cost = costs[graph.index(next)];
+
+                if (next_cost != DeltaSteppingSearch::UNREACHABLE
+                    && next_cost + graph.cost(next, current) == costs[graph.index(current)])
+                {
+                    current = next;
+                    break;
+                }
+            }
+
+            path.push_back(current);
+        }
+
+        std::reverse(path.begin(), path.end());
+
+        return path;
+    }
+
+    /**
+     * @brief Search a path from `start` to `goal` in a graph on a pool with a
+     * worker per core
+     *
+     * @param graph - graph to search
+     * @param start
+     * @param goal
+     * @param record - list of settled locations, bucket by bucket. Saves
+     * location (`Location`), time taken (`std::chrono::microseconds`), and a
+     * cost of location (`Graph::cost_t`)
+     *
+     * @return std::vector<Location> - path from `start` to `goal`
+     */
+    static std::vector<typename Graph::Location> search(
+        const Graph                               &graph,
+        const typename Graph::Location            &start,
+        const typename Graph::Location            &goal,
+        std::vector<typename Graph::ChangeRecord> &record
+    )
+    {
+        return DeltaSteppingSearch::search(graph, start, goal, record, ThreadPool::shared());
+    }
+
+    /**
+     * @brief Get cost from `start` to every location of a graph
+     *
+     * @param graph
+     * @param start
+     * @param pool - workers to relax edges on
+     * @param delta - width of a bucket
+     * @return std::vector<Graph::cost_t> - costs by location index,
+     * `UNREACHABLE` if location cannot be reached
+     */
+    static std::vector<typename Graph::cost_t> distances(
+        const Graph                    &graph,
+        const typename Graph::Location &start,
+        ThreadPool                     &pool,
+        const typename Graph::cost_t    delta = 1
+    )
+    {
+        return DeltaSteppingSearch::expand(graph, start, DenseSearchState<Graph>::NONE, delta, pool, nullptr);
+    }
+};
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <vector>
+
+#include "algorithm/pathfinder/best_first_search.h"
+#include "algorithm/pathfinder/search_policy.h"
+#include "data_structure/indexed_heap.h"
+#include "data_structure/priority_queue.h"
+#include "data_structure/search_workspace.h"
+#include "utility/recording.h"
+
+/**
+ * Depth-first search, best-first search ordered by the most expensive way.
+ * Follows one way as deep as it goes before trying another, so the path is
+ * usually far from the cheapest one
+ *
+ * @tparam Graph
+ * @tparam Frontier - queue of location indices ordered by cost, one of
+ * `PriorityQueue` or `IndexedHeap`. Priorities decrease with depth, so
+ * `BucketQueue` cannot be used
+ * @tparam Recording - which expansions are saved to the record, one of
+ * `FullRecording`, `SampledRecording` or `NoRecording`
+ */
+template <
+    typename Graph,
+    typename Frontier  = PriorityQueue<typename Graph::index_t, typename Graph::cost_t>,
+    typename Recording = FullRecording>
+class DepthFirstSearch : BasePathFinder<Graph>
+{
+  public:
+    /**
+     * @brief Search a path from `start` to `goal` in a graph
+     *
+     * @param graph - graph to search
+     * @param start
+     * @param goal
+     * @param record - list of steps taken by the algorithm. Saves location
+     * (`Location`), time taken (`std::chrono::microseconds`), and a cost of
+     * location (`Graph::cost_t`), not saved if `nullptr`
+     * @param workspace - memory of the search, reused between searches
+     *
+     * @return std::vector<Location> - path from `start` to `goal`
+     */
+    static std::vector<typename Graph::Location> search(
+        const Graph                               &graph,
+        const typename Graph::Location            &start,
+        const typename Graph::Location            &goal,
+        std::vector<typename Graph::ChangeRecord> *record,
+        SearchWorkspace<Graph, Frontier>          &workspace
+    )
+    {
+        return BestFirstSearch<Graph, Frontier, Recording>::search(
+            graph, start, goal, DepthFirstPriority<Graph>(), GraphCost<Graph>{graph}, record, workspace
+        );
+    }
+
+    /**
+     * @brief Search a path from `start` to `goal` in a graph
+     *
+     * @param graph - graph to search
+     * @param start
+     * @param goal
+     * @param record - list of steps taken by the algorithm. Saves location
+     * (`Location`), time taken (`std::chrono::microseconds`), and a cost of
+     * location (`Graph::cost_t`)
+     *
+     * @return std::vector<Location> - path from `start` to `goal`
+     */
+    static std::vector<typename Graph::Location> search(
+        const Graph                               &graph,
+        const typename Graph::Location            &start,
+        const typename Graph::Location            &goal,
+        std::vector<typename Graph::ChangeRecord> &record
+    )
+    {
+        return DepthFirstSearch::search(graph, start, goal, &record, SearchWorkspace<Graph, Frontier>::local());
+    }
+};
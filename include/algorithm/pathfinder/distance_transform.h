@@ -0,0 +1,319 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/**
+ * Distance from a source to every location of a grid with uniform cost, found
+ * by flooding bit-packed rows. Each step of the wavefront moves the frontier
+ * bits east and west with shifts, north and south by reading the rows above
+ * and below, and keeps only passable cells not visited yet.
+ *
+ * Rows are copied into a layout padded with empty guard words, so the first
+ * and last words of a row and the first and last rows need no special case,
+ * and a padded row is a whole number of 256-cell blocks. A block is one AVX2
+ * vector, and only blocks with wavefront cells and blocks next to them are
+ * processed, so a step costs as much as the wavefront. Vector kernel uses
+ * AVX2 when compiled for it, SSE2 otherwise, and the scalar kernel gives the
+ * same distances on any target
+ *
+ * @tparam Graph - grid with row-major bit mask `cells` padded to `row_words`
+ * words per row
+ * @tparam distance_t - unsigned type of a distance, 16 bits keep the map small
+ * but fit only distances below 65535
+ */
+template <typename Graph, typename distance_t = uint16_t> class DistanceTransform
+{
+  private:
+    /** Words of a block, one 256-bit vector */
+    static const size_t BLOCK_WORDS = 4;
+
+    /**
+     * @brief Advance the wavefront in the block that starts with word `begin`
+     *
+     * @tparam is_vectorized - use SIMD instructions where available
+     * @param begin - index of the first word of the block
+     * @param stride - words in a padded row
+     * @param passable
+     * @param frontier - current wavefront
+     * @param visited - updated with the new wavefront
+     * @param next - new wavefront of the block
+     * @return true - if the block has new wavefront cells
+     * @return false
+     */
+    template <bool is_vectorized>
+    static inline bool advance(
+        const size_t    begin,
+        const size_t    stride,
+        const uint64_t *passable,
+        const uint64_t *frontier,
+        uint64_t       *visited,
+        uint64_t       *next
+    )
+    {
+#if defined(__AVX2__)
+        if (is_vectorized)
+        {
+            __m256i current = _mm256_loadu_si256((const __m256i *)(frontier + begin));
+            __m256i west    = _mm256_loadu_si256((const __m256i *)(frontier + begin - 1));
+            __m256i east    = _mm256_loadu_si256((const __m256i *)(frontier + begin + 1));
+            __m256i north   = _mm256_loadu_si256((const __m256i *)(frontier + begin - stride));
+            __m256i south   = _mm256_loadu_si256((const __m256i *)(frontier + begin + stride));
+
+            __m256i candidates = _mm256_or_si256(
+                _mm256_or_si256(
+                    _mm256_or_si256(_mm256_slli_epi64(current, 1), _mm256_srli_epi64(west, 63)),
+                    _mm256_or_si256(_mm256_srli_epi64(current, 1), _mm256_slli_epi64(east, 63))
+                ),
+                _mm256_or_si256(north, south)
+            );
+
+            __m256i seen  = _mm256_loadu_si256((const __m256i *)(visited + begin));
+            __m256i cells = _mm256_andnot_si256(
+                seen, _mm256_and_si256(candidates, _mm256_loadu_si256((const __m256i *)(passable + begin)))
+            );
+
+            _mm256_storeu_si256((__m256i *)(next + begin), cells);
+            _mm256_storeu_si256((__m256i *)(visited + begin), _mm256_or_si256(seen, cells));
+
+            return !_mm256_testz_si256(cells, cells);
+        }
+#elif defined(__SSE2__)
+        if (is_vectorized)
+        {
+            __m128i any = _mm_setzero_si128();
+
+            for (size_t i = begin; i < begin + DistanceTransform::BLOCK_WORDS; i += 2)
+            {
+                __m128i current = _mm_loadu_si128((const __m128i *)(frontier + i));
+                __m128i west    = _mm_loadu_si128((const __m128i *)(frontier + i - 1));
+                __m128i east    = _mm_loadu_si128((const __m128i *)(frontier + i + 1));
+                __m128i north   = _mm_loadu_si128((const __m128i *)(frontier + i - stride));
+                __m128i south   = _mm_loadu_si128((const __m128i *)(frontier + i + stride));
+
+                __m128i candidates = _mm_or_si128(
+                    _mm_or_si128(
+                        _mm_or_si128(_mm_slli_epi64(current, 1), _mm_srli_epi64(west, 63)),
+                        _mm_or_si128(_mm_srli_epi64(current, 1), _mm_slli_epi64(east, 63))
+                    ),
+                    _mm_or_si128(north, south)
+                );
+
+                __m128i seen  = _mm_loadu_si128((const __m128i *)(visited + i));
+                __m128i cells = _mm_andnot_si128(
+                    seen, _mm_and_si128(candidates, _mm_loadu_si128((const __m128i *)(passable + i)))
+                );
+
+                _mm_storeu_si128((__m128i *)(next + i), cells);
+                _mm_storeu_si128((__m128i *)(visited + i), _mm_or_si128(seen, cells));
+
+                any = _mm_or_si128(any, cells);
+            }
+
+            return _mm_movemask_epi8(_mm_cmpeq_epi8(any, _mm_setzero_si128())) != 0xFFFF;
+        }
+#endif
+
+        uint64_t any = 0;
+
+        for (size_t i = begin; i < begin + DistanceTransform::BLOCK_WORDS; i++)
+        {
+            // east and west inside the word, carry over word boundary, guard words hold no cells
+            uint64_t candidates = (frontier[i] << 1) | (frontier[i - 1] >> 63) | (frontier[i] >> 1)
+                                  | (frontier[i + 1] << 63) | frontier[i - stride] | frontier[i + stride];
+
+            uint64_t cells = candidates & passable[i] & ~visited[i];
+
+            next[i] = cells;
+            visited[i] |= cells;
+            any |= cells;
+        }
+
+        return any != 0;
+    }
+
+    /**
+     * @brief Flood the grid from `start`
+     *
+     * @tparam is_vectorized - use SIMD instructions where available
+     * @param graph
+     * @param start
+     * @return std::vector<distance_t>
+     */
+    template <bool is_vectorized>
+    static std::vector<distance_t> flood(const Graph &graph, const typename Graph::Location &start)
+    {
+        const size_t block = DistanceTransform::BLOCK_WORDS;
+
+        // padded row holds at least one guard word and is a whole number of blocks,
+        // guard rows above and below the grid are padded rows too
+        const size_t stride     = (graph.row_words + block) / block * block;
+        const size_t row_blocks = stride / block;
+        const size_t words      = (graph.height + 2) * stride;
+
+        std::vector<uint64_t> passable(words, 0);
+        std::vector<uint64_t> visited(words, 0);
+        std::vector<uint64_t> frontier(words, 0);
+        std::vector<uint64_t> next(words, 0);
+
+        for (size_t y = 0; y < graph.height; y++)
+        {
+            std::copy(
+                graph.cells.begin() + y * graph.row_words,
+                graph.cells.begin() + (y + 1) * graph.row_words,
+                passable.begin() + (y + 1) * stride
+            );
+        }
+
+        std::vector<distance_t> distances(graph.size(), DistanceTransform::UNREACHABLE);
+
+        // blocks with wavefront cells, only they and blocks next to them can change
+        std::vector<size_t>   blocks;
+        std::vector<size_t>   next_blocks;
+        std::vector<size_t>   candidates;
+        std::vector<uint64_t> candidate_in(words / block, 0);
+
+        size_t start_word = (start.y + 1) * stride + (start.x >> 6);
+
+        frontier[start_word] = visited[start_word] = uint64_t(1) << (start.x & 63);
+        blocks.push_back(start_word / block);
+        distances[graph.index(start)] = 0;
+
+        for (uint64_t distance = 1; !blocks.empty(); distance++)
+        {
+            candidates.clear();
+
+            auto addCandidate = [&](const size_t index) {
+                if (candidate_in[index] != distance)
+                {
+                    candidate_in[index] = distance;
+                    candidates.push_back(index);
+                }
+            };
+
+            for (size_t index : blocks)
+            {
+                size_t y = index / row_blocks - 1;
+                size_t x = index % row_blocks;
+
+                addCandidate(index);
+
+                // west and east blocks only get the cells at the edges of this one
+                if (x > 0 && (frontier[index * block] & 1) != 0)
+                {
+                    addCandidate(index - 1);
+                }
+
+                if (x + 1 < row_blocks && (frontier[index * block + block - 1] >> 63) != 0)
+                {
+                    addCandidate(index + 1);
+                }
+
+                if (y > 0)
+                {
+                    addCandidate(index - row_blocks);
+                }
+
+                if (y + 1 < graph.height)
+                {
+                    addCandidate(index + row_blocks);
+                }
+            }
+
+            next_blocks.clear();
+
+            for (size_t index : candidates)
+            {
+                if (!DistanceTransform::advance<is_vectorized>(
+                        index * block, stride, passable.data(), frontier.data(), visited.data(), next.data()
+                    ))
+                {
+                    continue;
+                }
+
+                if (distance >= DistanceTransform::UNREACHABLE)
+                {
+                    throw std::invalid_argument(
+                        "Argument exception: Cannot build distance transform. Distance does not fit distance type."
+                    );
+                }
+
+                next_blocks.push_back(index);
+
+                size_t y = index / row_blocks - 1;
+                size_t x = index % row_blocks * block * 64;
+
+                for (size_t word = 0; word < block; word++)
+                {
+                    // guard words hold no cells, so no location past the width is written
+                    for (uint64_t rest = next[index * block + word]; rest != 0; rest &= rest - 1)
+                    {
+                        distances[y * graph.width + x + word * 64 + __builtin_ctzll(rest)] = (distance_t)distance;
+                    }
+                }
+            }
+
+            // old wavefront is cleared, so the buffer can hold the wavefront after next
+            for (size_t index : blocks)
+            {
+                std::fill(frontier.begin() + index * block, frontier.begin() + (index + 1) * block, 0);
+            }
+
+            frontier.swap(next);
+            blocks.swap(next_blocks);
+        }
+
+        return distances;
+    }
+
+  public:
+    /** Distance of a location that cannot be reached */
+    static constexpr distance_t UNREACHABLE = std::numeric_limits<distance_t>::max();
+
+    /**
+     * @brief Get name of the kernel used when vectorized
+     *
+     * @return const char* - "avx2", "sse2" or "scalar"
+     */
+    static constexpr const char *vectorKernel()
+    {
+#if defined(__AVX2__)
+        return "avx2";
+#elif defined(__SSE2__)
+        return "sse2";
+#else
+        return "scalar";
+#endif
+    }
+
+    /**
+     * @brief Get distance from `start` to every location of a graph
+     *
+     * @param graph
+     * @param start
+     * @param is_vectorized - use SIMD instructions where available, the
+     * scalar kernel gives the same distances
+     * @return std::vector<distance_t> - distances by location index,
+     * `UNREACHABLE` if location cannot be reached
+     */
+    static std::vector<distance_t> distances(
+        const Graph &graph, const typename Graph::Location &start, const bool is_vectorized = true
+    )
+    {
+        if (is_vectorized)
+        {
+            return DistanceTransform::flood<true>(graph, start);
+        }
+
+        return DistanceTransform::flood<false>(graph, start);
+    }
+};
@@ -0,0 +1,256 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "algorithm/pathfinder/base_path_finder.h"
+#include "algorithm/pathfinder/delta_stepping_search.h"
+#include "data_structure/parent_directions.h"
+#include "utility/thread_pool.h"
+
+/**
+ * Distance to a single goal from every location of a grid, together with the
+ * direction of the next step towards the goal. Once it is built, a path from
+ * any location is read in steps along the stored directions without a search,
+ * so many agents that share a goal share one search.
+ *
+ * Distances are found with a delta-stepping search from the goal, which is the
+ * same as a search towards the goal on a graph with symmetric costs, so the
+ * next step is the parent of a location in that search. Directions are kept
+ * in `ParentDirections` and found by workers of the pool one range of words
+ * each.
+ * Distances are kept in 16 bits when the largest one fits
+ *
+ * @tparam Graph - grid with `directions` and symmetric costs
+ */
+template <typename Graph> class FlowField : BasePathFinder<Graph>
+{
+  private:
+    /** Distance that marks unreachable location in 16-bit distances */
+    static constexpr uint16_t NARROW_UNREACHABLE = std::numeric_limits<uint16_t>::max();
+
+    const Graph             &graph;
+    typename Graph::Location goal;
+    ThreadPool              &pool;
+
+    /** Distances by location index, only one of them is filled */
+    std::vector<uint16_t>               narrow;
+    std::vector<typename Graph::cost_t> wide;
+
+    ParentDirections<Graph> steps;
+
+    /**
+     * @brief Keep `costs` in 16 bits if the largest one fits, in
+     * `Graph::cost_t` otherwise
+     *
+     * @param costs - distances by location index
+     */
+    void store(std::vector<typename Graph::cost_t> &&costs)
+    {
+        bool fits = std::all_of(costs.begin(), costs.end(), [](typename Graph::cost_t cost) {
+            return cost == FlowField::UNREACHABLE || cost < FlowField::NARROW_UNREACHABLE;
+        });
+
+        // distances of the other width from an earlier build give their memory back
+        if (!fits)
+        {
+            this->narrow = std::vector<uint16_t>();
+            this->wide   = std::move(costs);
+            return;
+        }
+
+        this->wide = std::vector<typename Graph::cost_t>();
+        this->narrow.resize(costs.size());
+
+        for (size_t index = 0; index < costs.size(); index++)
+        {
+            this->narrow[index] = costs[index] == FlowField::UNREACHABLE ? FlowField::NARROW_UNREACHABLE
+                                                                         : (uint16_t)costs[index];
+        }
+    }
+
+  public:
+    /** Distance of a location from which the goal cannot be reached */
+    static constexpr typename Graph::cost_t UNREACHABLE = DeltaSteppingSearch<Graph>::UNREACHABLE;
+
+    /**
+     * @brief Construct a new Flow Field object towards `goal` and build it
+     *
+     * @param graph - graph to build field on, must outlive the field
+     * @param goal
+     * @param pool - workers to build field on
+     */
+    FlowField(const Graph &graph, const typename Graph::Location &goal, ThreadPool &pool)
+        : graph(graph), goal(goal), pool(pool), steps(graph.size())
+    {
+        this->update();
+    }
+
+    /**
+     * @brief Construct a new Flow Field object towards `goal` and build it on
+     * a pool with a worker per core
+     *
+     * @param graph - graph to build field on, must outlive the field
+     * @param goal
+     */
+    FlowField(const Graph &graph, const typename Graph::Location &goal)
+        : FlowField(graph, goal, ThreadPool::shared())
+    {
+    }
+
+    /**
+     * @brief Rebuild field after passability of the graph was changed
+     *
+     */
+    void update()
+    {
+        std::vector<typename Graph::cost_t> costs
+            = DeltaSteppingSearch<Graph>::distances(this->graph, this->goal, this->pool);
+
+        this->steps.reset(costs.size());
+
+        size_t workers = this->pool.size();
+
+        // workers own whole words, so they never write to the same one
+        auto task = [&](size_t worker) {
+            size_t begin = this->steps.size() * worker / workers;
+            size_t end   = this->steps.size() * (worker + 1) / workers;
+
+            for (size_t word = begin; word < end; word++)
+            {
+                size_t first = word * ParentDirections<Graph>::WORD_LOCATIONS;
+                size_t last  = std::min(first + ParentDirections<Graph>::WORD_LOCATIONS, costs.size());
+
+                for (size_t index = first; index < last; index++)
+                {
+                    typename Graph::cost_t cost = costs[index];
+
+                    if (cost == FlowField::UNREACHABLE || cost == 0)
+                    {
+                        continue;
+                    }
+
+                    typename Graph::Location current = this->graph.location(index);
+
+                    for (size_t direction = 0; direction < Graph::directions.size(); direction++)
+                    {
+                        typename Graph::Location next{
+                            current.x + Graph::directions[direction].x, current.y + Graph::directions[direction].y};
+
+                        if (!this->graph.isInBounds(next))
+                        {
+                            continue;
+                        }
+
+                        typename Graph::cost_t next_cost = costs[this->graph.index(next)];
+
+                        if (next_cost != FlowField::UNREACHABLE && next_cost + this->graph.cost(next, current) == cost)
+                        {
+                            this->steps.set(index, direction);
+                            break;
+                        }
+                    }
+                }
+            }
+        };
+
+        this->pool.run(task);
+
+        this->store(std::move(costs));
+    }
+
+    /**
+     * @brief Get goal of the field
+     *
+     * @return const Graph::Location&
+     */
+    inline const typename Graph::Location &target() const
+    {
+        return this->goal;
+    }
+
+    /**
+     * @brief Get distance to the goal from every location
+     *
+     * @return std::vector<Graph::cost_t> - distances by location index,
+     * `UNREACHABLE` if goal cannot be reached from location
+     */
+    std::vector<typename Graph::cost_t> distances() const
+    {
+        if (this->narrow.empty())
+        {
+            return this->wide;
+        }
+
+        std::vector<typename Graph::cost_t> distances(this->narrow.size());
+
+        for (size_t index = 0; index < this->narrow.size(); index++)
+        {
+            distances[index] = this->narrow[index] == FlowField::NARROW_UNREACHABLE ? FlowField::UNREACHABLE
+                                                                                    : this->narrow[index];
+        }
+
+        return distances;
+    }
+
+    /**
+     * @brief Get distance to the goal from `location`
+     *
+     * @param location
+     * @return Graph::cost_t - `UNREACHABLE` if goal cannot be reached
+     */
+    inline typename Graph::cost_t distance(const typename Graph::Location &location) const
+    {
+        typename Graph::index_t index = this->graph.index(location);
+
+        if (this->narrow.empty())
+        {
+            return this->wide[index];
+        }
+
+        return this->narrow[index] == FlowField::NARROW_UNREACHABLE ? FlowField::UNREACHABLE : this->narrow[index];
+    }
+
+    /**
+     * @brief Get the next step towards the goal from `location`
+     *
+     * @param location - location from which goal can be reached, other than
+     * the goal
+     * @return Graph::Location
+     */
+    inline typename Graph::Location next(const typename Graph::Location &location) const
+    {
+        const typename Graph::Location &step = Graph::directions[this->steps.direction(this->graph.index(location))];
+        return {location.x + step.x, location.y + step.y};
+    }
+
+    /**
+     * @brief Read a path from `start` to the goal
+     *
+     * @param start
+     * @return std::vector<Location> - path from `start` to the goal, empty if
+     * goal cannot be reached
+     */
+    std::vector<typename Graph::Location> path(const typename Graph::Location &start) const
+    {
+        std::vector<typename Graph::Location> path;
+
+        if (this->distance(start) == FlowField::UNREACHABLE)
+        {
+            return path; // no path can be found
+        }
+
+        path.reserve(this->distance(start) + 1);
+        path.push_back(start);
+
+        while (path.back() != this->goal)
+        {
+            path.push_back(this->next(path.back()));
+        }
+
+        return path;
+    }
+};
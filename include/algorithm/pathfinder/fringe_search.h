@@ -0,0 +1,235 @@
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <vector>
+
+#include "algorithm/pathfinder/base_path_finder.h"
+#include "algorithm/pathfinder/search_policy.h"
+#include "data_structure/hash_table.h"
+#include "utility/recording.h"
+#include "utility/timer.h"
+
+/**
+ * Fringe search. Expands locations in the same order as iterative deepening
+ * A*, but keeps the fringe of the last iteration in a list, so the next one
+ * continues from it instead of searching from `start` again. Locations within
+ * the limit are expanded in list order, their neighbors are put right after
+ * them, and locations over the limit stay in the list for the next iteration.
+ *
+ * Unlike A*, nothing is sorted: the fringe is a linked list threaded through
+ * the ways of visited locations, so a step costs O(1) hash lookups. Ways are
+ * kept in a `HashTable` of visited locations only, so memory grows with the
+ * searched area, not with the graph, and a short query stays small. With a
+ * consistent heuristic the path is the cheapest one
+ *
+ * @tparam Graph
+ * @tparam Recording - which expansions are saved to the record, one of
+ * `FullRecording`, `SampledRecording` or `NoRecording`
+ */
+template <typename Graph, typename Recording = FullRecording> class FringeSearch : BasePathFinder<Graph>
+{
+  private:
+    /** Link of a location that is not in the fringe */
+    static constexpr typename Graph::index_t NONE = std::numeric_limits<typename Graph::index_t>::max();
+
+    static constexpr typename Graph::cost_t UNLIMITED = std::numeric_limits<typename Graph::cost_t>::max();
+
+    /** Way to a visited location and its links in the fringe */
+    struct Node
+    {
+        typename Graph::cost_t  cost;
+        typename Graph::index_t parent;
+        typename Graph::index_t next;
+        typename Graph::index_t previous;
+    };
+
+    /**
+     * @brief Reconstruct path from `start` to `goal` from parents of
+     * visited locations
+     *
+     * @param graph
+     * @param start
+     * @param goal - visited location
+     * @param nodes
+     * @return std::vector<Location>
+     */
+    static std::vector<typename Graph::Location> reconstruct_path(
+        const Graph                                    &graph,
+        const typename Graph::Location                 &start,
+        const typename Graph::Location                 &goal,
+        const HashTable<typename Graph::index_t, Node> &nodes
+    )
+    {
+        std::vector<typename Graph::Location> path;
+
+        typename Graph::index_t start_index = graph.index(start);
+        typename Graph::index_t current     = graph.index(goal);
+
+        while (current != start_index)
+        {
+            path.push_back(graph.location(current));
+            current = nodes.find(current)->parent;
+        }
+
+        path.push_back(start);
+
+        // reconstructed path will start from end, so reverse
+        std::reverse(path.begin(), path.end());
+
+        return path;
+    }
+
+  public:
+    /**
+     * @brief Search a path from `start` to `goal` in a graph with heuristic
+     * and cost known at compile time
+     *
+     * @tparam Heuristic - consistent functor of two locations, see
+     * `search_policy.h`
+     * @tparam Cost - functor of two locations, see `search_policy.h`
+     * @param graph - graph to search
+     * @param start
+     * @param goal
+     * @param heuristic - heuristic to determine distance from the goal
+     * @param cost - cost of a step between two neighbors
+     * @param record - list of steps taken by the algorithm. Saves location
+     * (`Location`), time taken (`std::chrono::microseconds`), and a cost of
+     * location (`Graph::cost_t`), not saved if `nullptr`
+     *
+     * @return std::vector<Location> - path from `start` to `goal`
+     */
+    template <typename Heuristic, typename Cost>
+    static std::vector<typename Graph::Location> search(
+        const Graph                               &graph,
+        const typename Graph::Location            &start,
+        const typename Graph::Location            &goal,
+        const Heuristic                           &heuristic,
+        const Cost                                &cost,
+        std::vector<typename Graph::ChangeRecord> *record
+    )
+    {
+        // every visited location and the list sentinel, which is never a location index
+        HashTable<typename Graph::index_t, Node> nodes;
+
+        typename Graph::index_t head = (typename Graph::index_t)graph.size();
+
+        // nodes move when the table grows, so they are found again after every insertion
+        auto unlink = [&](const typename Graph::index_t index) {
+            Node &node = *nodes.find(index);
+
+            nodes.find(node.previous)->next = node.next;
+            nodes.find(node.next)->previous = node.previous;
+            node.next                       = FringeSearch::NONE;
+        };
+
+        auto linkAfter = [&](const typename Graph::index_t index, const typename Graph::index_t after) {
+            Node &node  = *nodes.find(index);
+            Node &first = *nodes.find(after);
+
+            node.next     = first.next;
+            node.previous = after;
+            first.next    = index;
+
+            nodes.find(node.next)->previous = index;
+        };
+
+        typename Graph::index_t start_index = graph.index(start);
+        typename Graph::index_t goal_index  = graph.index(goal);
+
+        nodes[head]        = {typename Graph::cost_t(0), head, head, head};
+        nodes[start_index] = {typename Graph::cost_t(0), start_index, FringeSearch::NONE, FringeSearch::NONE};
+        linkAfter(start_index, head);
+
+        typename Graph::cost_t limit = heuristic(start, goal);
+
+        Timer     timer;
+        Recording recording;
+
+        while (nodes.find(head)->next != head)
+        {
+            typename Graph::cost_t next_limit = FringeSearch::UNLIMITED;
+
+            for (typename Graph::index_t current_index = nodes.find(head)->next; current_index != head;)
+            {
+                typename Graph::Location current      = graph.location(current_index);
+                typename Graph::cost_t   current_cost = nodes.find(current_index)->cost;
+                typename Graph::cost_t   estimate     = current_cost + heuristic(current, goal);
+
+                if (estimate > limit)
+                {
+                    next_limit    = std::min(next_limit, estimate);
+                    current_index = nodes.find(current_index)->next;
+                    continue;
+                }
+
+                if (current_index == goal_index)
+                {
+                    return FringeSearch::reconstruct_path(graph, start, goal, nodes);
+                }
+
+                if (record != nullptr && recording.take())
+                {
+                    timer.tock();
+                    record->push_back({current, timer.duration(), 0, current_cost});
+                }
+
+                for (const typename Graph::Location &neighbor : graph.neighbors(current))
+                {
+                    typename Graph::index_t neighbor_index = graph.index(neighbor);
+                    typename Graph::cost_t  new_cost       = current_cost + cost(current, neighbor);
+
+                    Node *visited = nodes.find(neighbor_index);
+
+                    if (visited != nullptr && new_cost >= visited->cost)
+                    {
+                        continue;
+                    }
+
+                    // neighbor is searched right after the current location, even if it was already passed
+                    if (visited != nullptr && visited->next != FringeSearch::NONE)
+                    {
+                        unlink(neighbor_index);
+                    }
+
+                    nodes[neighbor_index] = {new_cost, current_index, FringeSearch::NONE, FringeSearch::NONE};
+                    linkAfter(neighbor_index, current_index);
+                }
+
+                typename Graph::index_t following = nodes.find(current_index)->next;
+                unlink(current_index);
+                current_index = following;
+            }
+
+            limit = next_limit;
+        }
+
+        return {}; // no path can be found
+    }
+
+    /**
+     * @brief Search a path from `start` to `goal` in a graph
+     *
+     * @param graph - graph to search
+     * @param start
+     * @param goal
+     * @param heuristic - consistent heuristic to determine distance from the
+     * goal
+     * @param record - list of steps taken by the algorithm. Saves location
+     * (`Location`), time taken (`std::chrono::microseconds`), and a cost of
+     * location (`Graph::cost_t`)
+     *
+     * @return std::vector<Location> - path from `start` to `goal`
+     */
+    static std::vector<typename Graph::Location> search(
+        const Graph                                                                              &graph,
+        const typename Graph::Location                                                           &start,
+        const typename Graph::Location                                                           &goal,
+        std::function<typename Graph::cost_t(typename Graph::Location, typename Graph::Location)> heuristic,
+        std::vector<typename Graph::ChangeRecord>                                                &record
+    )
+    {
+        return FringeSearch::search(graph, start, goal, heuristic, GraphCost<Graph>{graph}, &record);
+    }
+};
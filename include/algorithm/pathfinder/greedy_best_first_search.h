@@ -0,0 +1,90 @@
+#pragma once
+
+#include <vector>
+
+#include "algorithm/pathfinder/best_first_search.h"
+#include "algorithm/pathfinder/search_policy.h"
+#include "data_structure/indexed_heap.h"
+#include "data_structure/priority_queue.h"
+#include "data_structure/search_workspace.h"
+#include "utility/recording.h"
+
+/**
+ * Greedy best-first search, best-first search ordered by estimated cost to
+ * the goal only. Usually expands far fewer locations than A*, but the path is
+ * not the cheapest one
+ *
+ * @tparam Graph
+ * @tparam Frontier - queue of location indices ordered by cost, one of
+ * `PriorityQueue` or `IndexedHeap`. Estimates decrease towards the goal, so
+ * `BucketQueue` cannot be used
+ * @tparam Recording - which expansions are saved to the record, one of
+ * `FullRecording`, `SampledRecording` or `NoRecording`
+ */
+template <
+    typename Graph,
+    typename Frontier  = PriorityQueue<typename Graph::index_t, typename Graph::cost_t>,
+    typename Recording = FullRecording>
+class GreedyBestFirstSearch : BasePathFinder<Graph>
+{
+  public:
+    /**
+     * @brief Search a path from `start` to `goal` in a graph with heuristic
+     * known at compile time
+     *
+     * @tparam Heuristic - functor of two locations, see `search_policy.h`
+     * @param graph - graph to search
+     * @param start
+     * @param goal
+     * @param heuristic - heuristic to determine distance from the goal
+     * @param record - list of steps taken by the algorithm. Saves location
+     * (`Location`), time taken (`std::chrono::microseconds`), and a cost of
+     * location (`Graph::cost_t`), not saved if `nullptr`
+     * @param workspace - memory of the search, reused between searches
+     *
+     * @return std::vector<Location> - path from `start` to `goal`
+     */
+    template <typename Heuristic>
+    static std::vector<typename Graph::Location> search(
+        const Graph                               &graph,
+        const typename Graph::Location            &start,
+        const typename Graph::Location            &goal,
+        const Heuristic                           &heuristic,
+        std::vector<typename Graph::ChangeRecord> *record,
+        SearchWorkspace<Graph, Frontier>          &workspace
+    )
+    {
+        return BestFirstSearch<Graph, Frontier, Recording>::search(
+            graph, start, goal, GreedyPriority<Graph, Heuristic>{heuristic}, GraphCost<Graph>{graph}, record, workspace
+        );
+    }
+
+    /**
+     * @brief Search a path from `start` to `goal` in a graph
+     *
+     * @tparam Heuristic - functor of two locations, see `search_policy.h`, or
+     * a function such as `Graph::heuristic`
+     * @param graph - graph to search
+     * @param start
+     * @param goal
+     * @param heuristic - heuristic to determine distance from the goal
+     * @param record - list of steps taken by the algorithm. Saves location
+     * (`Location`), time taken (`std::chrono::microseconds`), and a cost of
+     * location (`Graph::cost_t`)
+     *
+     * @return std::vector<Location> - path from `start` to `goal`
+     */
+    template <typename Heuristic>
+    static std::vector<typename Graph::Location> search(
+        const Graph                               &graph,
+        const typename Graph::Location            &start,
+        const typename Graph::Location            &goal,
+        const Heuristic                           &heuristic,
+        std::vector<typename Graph::ChangeRecord> &record
+    )
+    {
+        return GreedyBestFirstSearch::search(
+            graph, start, goal, heuristic, &record, SearchWorkspace<Graph, Frontier>::local()
+        );
+    }
+};
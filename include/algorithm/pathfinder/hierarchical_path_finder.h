@@ -0,0 +1,584 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "data_structure/dense_search_state.h"
+#include "data_structure/priority_queue.h"
+#include "utility/timer.h"
+
+/**
+ * Hierarchical pathfinding (HPA*) for grids with uniform cost. Grid is split
+ * into square clusters. Passable cells on both sides of a cluster border
+ * become entrances, and costs between entrances of the same cluster are
+ * cached, which makes a small abstract graph.
+ *
+ * Query connects `start` and `goal` to entrances of their clusters, searches
+ * the abstract graph with A* and refines every abstract edge into cells.
+ * Paths are near-optimal: they may be longer than the shortest one, because
+ * each entrance has only one or two transition cells.
+ *
+ * Searcher keeps a reference to the graph. Call `update` after changing
+ * cells, it rebuilds only clusters that touch changed cells
+ *
+ * @tparam Graph - grid with `isInBounds` and `isPassable`
+ * @tparam Frontier - queue of abstract node indices ordered by cost, one of
+ * `PriorityQueue`, `BucketQueue` or `IndexedHeap`
+ */
+template <typename Graph, typename Frontier = PriorityQueue<typename Graph::index_t, typename Graph::cost_t>>
+class HierarchicalPathFinder
+{
+  public:
+    /** Cost between locations that cannot reach each other */
+    static constexpr typename Graph::cost_t UNREACHABLE = std::numeric_limits<typename Graph::cost_t>::max();
+
+    /** Entrances longer than this get a transition at both ends */
+    static const size_t MAX_SINGLE_TRANSITION_LENGTH = 6;
+
+    struct Cluster
+    {
+        typename Graph::Location from;
+        size_t                   width;
+        size_t                   height;
+
+        /** Location indices of entrance cells inside the cluster */
+        std::vector<typename Graph::index_t> nodes;
+
+        /** Costs between every pair of `nodes`, row-major */
+        std::vector<typename Graph::cost_t> costs;
+    };
+
+    /**
+     * @brief Construct a new Hierarchical Path Finder object and build the
+     * abstract graph of `graph`
+     *
+     * @param graph
+     * @param cluster_size - width and height of a cluster
+     */
+    HierarchicalPathFinder(const Graph &graph, const size_t cluster_size = 16)
+        : graph(graph),
+          cluster_size(cluster_size),
+          clusters_x((graph.width + cluster_size - 1) / std::max<size_t>(cluster_size, 1)),
+          clusters_y((graph.height + cluster_size - 1) / std::max<size_t>(cluster_size, 1)),
+          node_ids(graph.size(), DenseSearchState<Graph>::NONE)
+    {
+        if (cluster_size < 2)
+        {
+            throw std::invalid_argument(
+                "Argument exception: Cannot build hierarchical path finder. Cluster size must be at least 2."
+            );
+        }
+
+        this->clusters.resize(this->clusters_x * this->clusters_y);
+
+        for (size_t cluster = 0; cluster < this->clusters.size(); cluster++)
+        {
+            this->buildCluster(cluster);
+        }
+
+        this->numberNodes();
+    }
+
+    /**
+     * @brief Get amount of nodes in the abstract graph
+     *
+     * @return size_t
+     */
+    inline size_t size() const
+    {
+        return this->nodes.size();
+    }
+
+    /**
+     * @brief Rebuild clusters affected by `changed` cells
+     *
+     * @param changed - locations of cells that were changed in the graph
+     */
+    void update(const std::vector<typename Graph::Location> &changed)
+    {
+        std::vector<bool>   is_affected(this->clusters.size(), false);
+        std::vector<size_t> affected;
+
+        auto affect = [&](const typename Graph::Location &location) {
+            if (!this->graph.isInBounds(location))
+            {
+                return;
+            }
+
+            size_t cluster = this->clusterOf(location);
+
+            if (!is_affected[cluster])
+            {
+                is_affected[cluster] = true;
+                affected.push_back(cluster);
+            }
+        };
+
+        for (const typename Graph::Location &location : changed)
+        {
+            affect(location);
+
+            // entrances on the border are shared with the neighbor cluster
+            for (const typename Graph::Location &direction : Graph::directions)
+            {
+                affect({location.x + direction.x, location.y + direction.y});
+            }
+        }
+
+        for (size_t cluster : affected)
+        {
+            this->buildCluster(cluster);
+        }
+
+        this->numberNodes();
+    }
+
+    /**
+     * @brief Search a path from `start` to `goal` in the graph
+     *
+     * @param start
+     * @param goal
+     * @param record - list of abstract nodes expanded by the algorithm. Saves
+     * location (`Location`), time taken (`std::chrono::microseconds`), and a
+     * cost of location (`Graph::cost_t`)
+     *
+     * @return std::vector<Location> - path from `start` to `goal`
+     */
+    std::vector<typename Graph::Location> search(
+        const typename Graph::Location            &start,
+        const typename Graph::Location            &goal,
+        std::vector<typename Graph::ChangeRecord> &record
+    ) const
+    {
+        Timer timer;
+
+        // `start` and `goal` are temporary nodes after the cached ones
+        typename Graph::index_t start_id = (typename Graph::index_t)this->nodes.size();
+        typename Graph::index_t goal_id  = start_id + 1;
+
+        size_t start_cluster = this->clusterOf(start);
+        size_t goal_cluster  = this->clusterOf(goal);
+
+        std::vector<typename Graph::cost_t> start_costs = this->clusterCosts(start_cluster, start);
+        std::vector<typename Graph::cost_t> goal_costs  = this->clusterCosts(goal_cluster, goal);
+
+        std::vector<typename Graph::cost_t>  costs(this->nodes.size() + 2, UNREACHABLE);
+        std::vector<typename Graph::index_t> parents(this->nodes.size() + 2, DenseSearchState<Graph>::NONE);
+        std::vector<bool>                    is_closed(this->nodes.size() + 2, false);
+        Frontier                             frontier;
+
+        auto locationOf = [&](const typename Graph::index_t id) {
+            return id == start_id  ? start
+                   : id == goal_id ? goal
+                                   : this->graph.location(this->nodes[id]);
+        };
+
+        auto relax = [&](const typename Graph::index_t from,
+                         const typename Graph::index_t to,
+                         const typename Graph::cost_t  cost) {
+            if (cost == UNREACHABLE || costs[from] + cost >= costs[to])
+            {
+                return;
+            }
+
+            costs[to]   = costs[from] + cost;
+            parents[to] = from;
+            frontier.push(to, costs[to] + Graph::heuristic(locationOf(to), goal));
+        };
+
+        costs[start_id] = 0;
+        frontier.push(start_id, Graph::heuristic(start, goal));
+
+        while (!frontier.empty())
+        {
+            typename Graph::index_t current = frontier.pop();
+
+            // heuristic is consistent, so the first pop of a node is the best one
+            if (is_closed[current])
+            {
+                continue;
+            }
+
+            is_closed[current] = true;
+
+            typename Graph::Location location = locationOf(current);
+
+            timer.tock();
+            record.push_back({location, timer.duration(), 0, costs[current]});
+
+            if (current == goal_id)
+            {
+                break;
+            }
+
+            if (current == start_id)
+            {
+                const Cluster &cluster = this->clusters[start_cluster];
+
+                for (size_t position = 0; position < cluster.nodes.size(); position++)
+                {
+                    typename Graph::Location node = this->graph.location(cluster.nodes[position]);
+                    typename Graph::cost_t   cost = this->localCost(start_cluster, start_costs, node);
+                    relax(current, this->node_ids[cluster.nodes[position]], cost);
+                }
+
+                if (start_cluster == goal_cluster)
+                {
+                    relax(current, goal_id, this->localCost(start_cluster, start_costs, goal));
+                }
+
+                continue;
+            }
+
+            size_t         cluster_index = this->clusterOf(location);
+            const Cluster &cluster       = this->clusters[cluster_index];
+            size_t         position      = this->node_positions[current];
+
+            // cached costs inside the cluster
+            for (size_t next = 0; next < cluster.nodes.size(); next++)
+            {
+                typename Graph::cost_t cost = cluster.costs[position * cluster.nodes.size() + next];
+                relax(current, this->node_ids[cluster.nodes[next]], cost);
+            }
+
+            // transitions to entrances of neighbor clusters
+            for (const typename Graph::Location &next : this->graph.neighbors(location))
+            {
+                typename Graph::index_t next_id = this->node_ids[this->graph.index(next)];
+
+                if (next_id != DenseSearchState<Graph>::NONE && this->clusterOf(next) != cluster_index)
+                {
+                    relax(current, next_id, this->graph.cost(location, next));
+                }
+            }
+
+            if (cluster_index == goal_cluster)
+            {
+                relax(current, goal_id, this->localCost(goal_cluster, goal_costs, location));
+            }
+        }
+
+        std::vector<typename Graph::Location> path;
+
+        if (costs[goal_id] == UNREACHABLE)
+        {
+            return path; // no path can be found
+        }
+
+        std::vector<typename Graph::index_t> abstract_path;
+
+        for (typename Graph::index_t current = goal_id; current != start_id; current = parents[current])
+        {
+            abstract_path.push_back(current);
+        }
+
+        abstract_path.push_back(start_id);
+        std::reverse(abstract_path.begin(), abstract_path.end());
+
+        // refine abstract edges into cells
+        path.push_back(start);
+
+        for (size_t i = 1; i < abstract_path.size(); i++)
+        {
+            typename Graph::Location from = locationOf(abstract_path[i - 1]);
+            typename Graph::Location to   = locationOf(abstract_path[i]);
+
+            if (this->clusterOf(from) != this->clusterOf(to))
+            {
+                path.push_back(to);
+                continue;
+            }
+
+            this->refine(this->clusterOf(from), from, to, path);
+        }
+
+        return path;
+    }
+
+  private:
+    const Graph &graph;
+
+    size_t cluster_size;
+    size_t clusters_x;
+    size_t clusters_y;
+
+    std::vector<Cluster> clusters;
+
+    /** Location index of every abstract node */
+    std::vector<typename Graph::index_t> nodes;
+
+    /** Abstract node of every location, `NONE` if location is not a node */
+    std::vector<typename Graph::index_t> node_ids;
+
+    /** Position of every abstract node in `Cluster::nodes` */
+    std::vector<size_t> node_positions;
+
+    /**
+     * @brief Get index of the cluster that contains `location`
+     *
+     * @param location
+     * @return size_t
+     */
+    inline size_t clusterOf(const typename Graph::Location &location) const
+    {
+        return (location.y / this->cluster_size) * this->clusters_x + location.x / this->cluster_size;
+    }
+
+    /**
+     * @brief Check if `location` is inside `cluster` and passable
+     *
+     * @param cluster
+     * @param location
+     * @return true
+     * @return false
+     */
+    inline bool isInside(const Cluster &cluster, const typename Graph::Location &location) const
+    {
+        return cluster.from.x <= location.x && location.x < cluster.from.x + (int)cluster.width
+               && cluster.from.y <= location.y && location.y < cluster.from.y + (int)cluster.height
+               && this->graph.isPassable(location);
+    }
+
+    /**
+     * @brief Get cost from the location costs were computed for to `location`
+     * inside the cluster
+     *
+     * @param cluster
+     * @param costs - costs computed by `clusterCosts`
+     * @param location
+     * @return Graph::cost_t
+     */
+    inline typename Graph::cost_t localCost(
+        const size_t cluster, const std::vector<typename Graph::cost_t> &costs, const typename Graph::Location &location
+    ) const
+    {
+        const Cluster &current = this->clusters[cluster];
+        return costs[(location.y - current.from.y) * current.width + (location.x - current.from.x)];
+    }
+
+    /**
+     * @brief Get costs from `from` to every cell of `cluster` without leaving
+     * it
+     *
+     * @param cluster
+     * @param from
+     * @return std::vector<Graph::cost_t> - costs by row-major cell of the
+     * cluster
+     */
+    std::vector<typename Graph::cost_t> clusterCosts(const size_t cluster, const typename Graph::Location &from) const
+    {
+        const Cluster &current = this->clusters[cluster];
+
+        std::vector<typename Graph::cost_t>   costs(current.width * current.height, UNREACHABLE);
+        std::vector<typename Graph::Location> queue{from};
+
+        if (!this->isInside(current, from))
+        {
+            return costs;
+        }
+
+        costs[(from.y - current.from.y) * current.width + (from.x - current.from.x)] = 0;
+
+        for (size_t head = 0; head < queue.size(); head++)
+        {
+            typename Graph::Location location = queue[head];
+            typename Graph::cost_t   cost     = this->localCost(cluster, costs, location);
+
+            for (const typename Graph::Location &next : this->graph.neighbors(location))
+            {
+                if (!this->isInside(current, next))
+                {
+                    continue;
+                }
+
+                typename Graph::cost_t &next_cost
+                    = costs[(next.y - current.from.y) * current.width + (next.x - current.from.x)];
+
+                if (next_cost == UNREACHABLE)
+                {
+                    next_cost = cost + this->graph.cost(location, next);
+                    queue.push_back(next);
+                }
+            }
+        }
+
+        return costs;
+    }
+
+    /**
+     * @brief Append cells of the path from `from` to `to` inside `cluster`,
+     * excluding `from`
+     *
+     * @param cluster
+     * @param from
+     * @param to
+     * @param path
+     */
+    void refine(
+        const size_t                           cluster,
+        const typename Graph::Location        &from,
+        const typename Graph::Location        &to,
+        std::vector<typename Graph::Location> &path
+    ) const
+    {
+        std::vector<typename Graph::cost_t> costs = this->clusterCosts(cluster, to);
+
+        // walk to the neighbor that is closer to `to`
+        typename Graph::Location current = from;
+
+        while (current != to)
+        {
+            for (const typename Graph::Location &next : this->graph.neighbors(current))
+            {
+                if (this->isInside(this->clusters[cluster], next)
+                    && this->localCost(cluster, costs, next) + this->graph.cost(current, next)
+                           == this->localCost(cluster, costs, current))
+                {
+                    current = next;
+                    break;
+                }
+            }
+
+            path.push_back(current);
+        }
+    }
+
+    /**
+     * @brief Find transition cells of `cluster` on the border with cells
+     * `direction` away from it
+     *
+     * @param cluster
+     * @param direction - unit direction to the neighbor cluster
+     * @param nodes - cells of `cluster` are appended to it
+     */
+    void addTransitions(
+        const Cluster                        &cluster,
+        const typename Graph::Location       &direction,
+        std::vector<typename Graph::index_t> &nodes
+    ) const
+    {
+        // border cells of the cluster and the step along the border
+        typename Graph::Location first = cluster.from;
+        typename Graph::Location step{direction.y != 0 ? 1 : 0, direction.x != 0 ? 1 : 0};
+        size_t                   length = direction.x != 0 ? cluster.height : cluster.width;
+
+        if (direction.x > 0)
+        {
+            first.x += (int)cluster.width - 1;
+        }
+
+        if (direction.y > 0)
+        {
+            first.y += (int)cluster.height - 1;
+        }
+
+        auto isOpen = [&](const size_t offset) {
+            typename Graph::Location inside{first.x + step.x * (int)offset, first.y + step.y * (int)offset};
+            typename Graph::Location outside{inside.x + direction.x, inside.y + direction.y};
+
+            return this->graph.isInBounds(outside) && this->graph.isPassable(inside)
+                   && this->graph.isPassable(outside);
+        };
+
+        auto add = [&](const size_t offset) {
+            nodes.push_back(this->graph.index({first.x + step.x * (int)offset, first.y + step.y * (int)offset}));
+        };
+
+        for (size_t begin = 0; begin < length;)
+        {
+            if (!isOpen(begin))
+            {
+                begin++;
+                continue;
+            }
+
+            size_t end = begin;
+
+            while (end < length && isOpen(end))
+            {
+                end++;
+            }
+
+            if (end - begin < MAX_SINGLE_TRANSITION_LENGTH)
+            {
+                add(begin + (end - begin) / 2);
+            }
+            else
+            {
+                add(begin);
+                add(end - 1);
+            }
+
+            begin = end;
+        }
+    }
+
+    /**
+     * @brief Find entrances of `cluster` and costs between them
+     *
+     * @param cluster
+     */
+    void buildCluster(const size_t cluster)
+    {
+        Cluster &current = this->clusters[cluster];
+
+        current.from   = {(int)((cluster % this->clusters_x) * this->cluster_size),
+                          (int)((cluster / this->clusters_x) * this->cluster_size)};
+        current.width  = std::min(this->cluster_size, this->graph.width - current.from.x);
+        current.height = std::min(this->cluster_size, this->graph.height - current.from.y);
+
+        current.nodes.clear();
+
+        for (const typename Graph::Location &direction : Graph::directions)
+        {
+            this->addTransitions(current, direction, current.nodes);
+        }
+
+        // corner cells may be transitions of two borders
+        std::sort(current.nodes.begin(), current.nodes.end());
+        current.nodes.erase(std::unique(current.nodes.begin(), current.nodes.end()), current.nodes.end());
+
+        size_t count = current.nodes.size();
+        current.costs.assign(count * count, UNREACHABLE);
+
+        for (size_t from = 0; from < count; from++)
+        {
+            std::vector<typename Graph::cost_t> costs
+                = this->clusterCosts(cluster, this->graph.location(current.nodes[from]));
+
+            for (size_t to = 0; to < count; to++)
+            {
+                current.costs[from * count + to]
+                    = this->localCost(cluster, costs, this->graph.location(current.nodes[to]));
+            }
+        }
+    }
+
+    /**
+     * @brief Give every entrance of every cluster an abstract node index
+     *
+     */
+    void numberNodes()
+    {
+        for (typename Graph::index_t index : this->nodes)
+        {
+            this->node_ids[index] = DenseSearchState<Graph>::NONE;
+        }
+
+        this->nodes.clear();
+        this->node_positions.clear();
+
+        for (const Cluster &cluster : this->clusters)
+        {
+            for (size_t position = 0; position < cluster.nodes.size(); position++)
+            {
+                this->node_ids[cluster.nodes[position]] = (typename Graph::index_t)this->nodes.size();
+                this->nodes.push_back(cluster.nodes[position]);
+                this->node_positions.push_back(position);
+            }
+        }
+    }
+};
@@ -0,0 +1,239 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "algorithm/pathfinder/base_path_finder.h"
+#include "algorithm/pathfinder/search_policy.h"
+#include "data_structure/hash_table.h"
+#include "utility/recording.h"
+#include "utility/timer.h"
+
+/**
+ * Iterative deepening A* (IDA*). Runs depth-first searches that only follow
+ * ways whose cost plus heuristic is within a limit, and raises the limit to
+ * the lowest value that was cut off, until the goal is reached. With an
+ * admissible heuristic the first path found is the cheapest one.
+ *
+ * Search keeps only the current way and a hash set of its locations, so a
+ * way never runs into itself and memory grows with the length of the path,
+ * not with the searched area or the graph. A transposition table of fixed
+ * size remembers the cheapest cost each location was reached with in the
+ * current iteration; a location reached again for no less is not searched
+ * twice. Table slot is shared by many locations and the last one wins, so a
+ * smaller table only searches more.
+ *
+ * Every iteration searches the ways of the last one again, and open areas have
+ * many ways to each location, so IDA* is meant for small or corridor-like
+ * graphs. When the goal cannot be reached it gives up only after every way of
+ * its area was searched, which can take very long.
+ *
+ * Each location is recorded only the first time it is expanded, in whichever
+ * iteration that happens, so the record and its `expanded` count hold distinct
+ * locations rather than every repeated expansion. Remembering them makes the
+ * memory of a recorded search grow with the searched area
+ *
+ * @tparam Graph - graph with `NeighborList`
+ * @tparam Recording - which expansions are saved to the record, one of
+ * `FullRecording`, `SampledRecording` or `NoRecording`
+ */
+template <typename Graph, typename Recording = FullRecording>
+class IterativeDeepeningAStarSearch : BasePathFinder<Graph>
+{
+  private:
+    /** Location on the current way and its neighbors not tried yet */
+    struct Frame
+    {
+        typename Graph::index_t      index;
+        typename Graph::cost_t       cost;
+        typename Graph::NeighborList neighbors;
+        size_t                       next;
+    };
+
+    /** Cheapest cost of `index` in `iteration`, empty while `iteration` is 0 */
+    struct Entry
+    {
+        typename Graph::index_t index;
+        typename Graph::cost_t  cost;
+        uint32_t                iteration;
+    };
+
+    static constexpr typename Graph::cost_t UNLIMITED = std::numeric_limits<typename Graph::cost_t>::max();
+
+  public:
+    /** Entries of the transposition table if size is not given */
+    static const size_t TABLE_SIZE = 1 << 16;
+
+    /**
+     * @brief Search a path from `start` to `goal` in a graph with heuristic
+     * and cost known at compile time
+     *
+     * @tparam Heuristic - admissible functor of two locations, see
+     * `search_policy.h`
+     * @tparam Cost - functor of two locations, see `search_policy.h`
+     * @param graph - graph to search
+     * @param start
+     * @param goal
+     * @param heuristic - heuristic to determine distance from the goal
+     * @param cost - cost of a step between two neighbors
+     * @param record - list of steps taken by the algorithm. Saves location
+     * (`Location`), time taken (`std::chrono::microseconds`), and a cost of
+     * location (`Graph::cost_t`) of the first expansion of every location, not
+     * saved if `nullptr`
+     * @param table_size - entries of the transposition table
+     *
+     * @return std::vector<Location> - path from `start` to `goal`
+     */
+    template <typename Heuristic, typename Cost>
+    static std::vector<typename Graph::Location> search(
+        const Graph                               &graph,
+        const typename Graph::Location            &start,
+        const typename Graph::Location            &goal,
+        const Heuristic                           &heuristic,
+        const Cost                                &cost,
+        std::vector<typename Graph::ChangeRecord> *record,
+        const size_t                               table_size = IterativeDeepeningAStarSearch::TABLE_SIZE
+    )
+    {
+        if (table_size == 0)
+        {
+            throw std::invalid_argument(
+                "Argument exception: Cannot search with IDA*. Transposition table size must be greater than 0."
+            );
+        }
+
+        std::vector<Entry> table(table_size, Entry{0, 0, 0});
+        std::vector<Frame> way;
+
+        // depth of every location of the current way, hashed so memory grows with its length only
+        HashTable<typename Graph::index_t, size_t> on_way;
+
+        // iteration in which every recorded location was first expanded, so later iterations do not record it again
+        HashTable<typename Graph::index_t, uint32_t> recorded;
+
+        typename Graph::index_t goal_index = graph.index(goal);
+        typename Graph::cost_t  limit      = heuristic(start, goal);
+
+        Timer     timer;
+        Recording recording;
+
+        for (uint32_t iteration = 1; limit != IterativeDeepeningAStarSearch::UNLIMITED; iteration++)
+        {
+            typename Graph::cost_t next_limit = IterativeDeepeningAStarSearch::UNLIMITED;
+
+            // frames are reused between iterations, so neighbor lists are not reallocated
+            size_t depth = 1;
+            way.resize(std::max(way.size(), size_t(1)));
+            way[0] = {graph.index(start), typename Graph::cost_t(0), graph.neighbors(start), 0};
+
+            table[way[0].index % table.size()] = {way[0].index, typename Graph::cost_t(0), iteration};
+            on_way[way[0].index] = 0;
+
+            while (depth > 0)
+            {
+                Frame &frame = way[depth - 1];
+
+                if (frame.index == goal_index)
+                {
+                    std::vector<typename Graph::Location> path;
+                    path.reserve(depth);
+
+                    for (size_t step = 0; step < depth; step++)
+                    {
+                        path.push_back(graph.location(way[step].index));
+                    }
+
+                    return path;
+                }
+
+                if (frame.next == frame.neighbors.size())
+                {
+                    on_way.erase(frame.index);
+                    depth--;
+                    continue;
+                }
+
+                typename Graph::Location current = graph.location(frame.index);
+                typename Graph::Location next    = frame.neighbors[frame.next++];
+
+                typename Graph::index_t next_index = graph.index(next);
+
+                if (on_way.contains(next_index))
+                {
+                    continue; // never step back or around a cycle, even if the table forgot the location
+                }
+
+                typename Graph::cost_t next_cost = frame.cost + cost(current, next);
+                typename Graph::cost_t estimate  = next_cost + heuristic(next, goal);
+
+                if (estimate > limit)
+                {
+                    next_limit = std::min(next_limit, estimate);
+                    continue;
+                }
+
+                Entry &entry = table[next_index % table.size()];
+
+                if (entry.iteration == iteration && entry.index == next_index && entry.cost <= next_cost)
+                {
+                    continue; // searched already from a way that is not more expensive
+                }
+
+                entry = {next_index, next_cost, iteration};
+
+                if (Recording::is_enabled && record != nullptr && !recorded.contains(next_index))
+                {
+                    recorded[next_index] = iteration;
+
+                    if (recording.take())
+                    {
+                        timer.tock();
+                        record->push_back({next, timer.duration(), 0, next_cost});
+                    }
+                }
+
+                if (depth == way.size())
+                {
+                    way.emplace_back();
+                }
+
+                way[depth] = {next_index, next_cost, graph.neighbors(next), 0};
+                on_way[next_index] = depth;
+                depth++;
+            }
+
+            limit = next_limit;
+        }
+
+        return {}; // no path can be found
+    }
+
+    /**
+     * @brief Search a path from `start` to `goal` in a graph
+     *
+     * @param graph - graph to search
+     * @param start
+     * @param goal
+     * @param heuristic - admissible heuristic to determine distance from the
+     * goal
+     * @param record - list of steps taken by the algorithm. Saves location
+     * (`Location`), time taken (`std::chrono::microseconds`), and a cost of
+     * location (`Graph::cost_t`)
+     *
+     * @return std::vector<Location> - path from `start` to `goal`
+     */
+    static std::vector<typename Graph::Location> search(
+        const Graph                                                                              &graph,
+        const typename Graph::Location                                                           &start,
+        const typename Graph::Location                                                           &goal,
+        std::function<typename Graph::cost_t(typename Graph::Location, typename Graph::Location)> heuristic,
+        std::vector<typename Graph::ChangeRecord>                                                &record
+    )
+    {
+        return IterativeDeepeningAStarSearch::search(graph, start, goal, heuristic, GraphCost<Graph>{graph}, &record);
+    }
+};
@@ -0,0 +1,288 @@
+#pragma once
+
+#include <cstdlib>
+#include <functional>
+#include <optional>
+#include <vector>
+
+#include "algorithm/pathfinder/base_path_finder.h"
+#include "data_structure/bucket_queue.h"
+#include "data_structure/dense_search_state.h"
+#include "data_structure/indexed_heap.h"
+#include "data_structure/priority_queue.h"
+#include "utility/timer.h"
+
+/**
+ * Jump Point Search for 4-connected grids with uniform cost. Instead of
+ * pushing every neighbor, it jumps along straight lines and pushes only
+ * locations where the path may need to turn.
+ *
+ * Horizontal jumps stop at locations with a forced neighbor above or below.
+ * Vertical jumps also stop where a horizontal jump from them finds a jump
+ * point
+ *
+ * @tparam Graph - grid with `isInBounds` and `isPassable`
+ * @tparam Frontier - queue of location indices ordered by cost, one of
+ * `PriorityQueue`, `BucketQueue` or `IndexedHeap`
+ */
+template <typename Graph, typename Frontier = PriorityQueue<typename Graph::index_t, typename Graph::cost_t>>
+class JumpPointSearch : BasePathFinder<Graph>
+{
+  private:
+    /**
+     * @brief Check if `location` is in bounds and passable
+     *
+     * @param graph
+     * @param location
+     * @return true
+     * @return false
+     */
+    static inline bool isWalkable(const Graph &graph, const typename Graph::Location &location)
+    {
+        return graph.isInBounds(location) && graph.isPassable(location);
+    }
+
+    /**
+     * @brief Jump horizontally from `from` in direction `dx`
+     *
+     * @param graph
+     * @param from
+     * @param dx - either 1 or -1
+     * @param goal
+     * @return std::optional<Location> - jump point, empty if jump hit a wall
+     */
+    static std::optional<typename Graph::Location> jumpHorizontal(
+        const Graph &graph, const typename Graph::Location &from, const int dx, const typename Graph::Location &goal
+    )
+    {
+        typename Graph::Location current = from;
+
+        while (true)
+        {
+            current.x += dx;
+
+            if (!isWalkable(graph, current))
+            {
+                return std::nullopt;
+            }
+
+            if (current == goal)
+            {
+                return current;
+            }
+
+            int x = current.x;
+            int y = current.y;
+
+            // cell above or below can only be reached through `current`
+            if ((isWalkable(graph, {x, y - 1}) && !isWalkable(graph, {x - dx, y - 1}))
+                || (isWalkable(graph, {x, y + 1}) && !isWalkable(graph, {x - dx, y + 1})))
+            {
+                return current;
+            }
+        }
+    }
+
+    /**
+     * @brief Jump vertically from `from` in direction `dy`
+     *
+     * @param graph
+     * @param from
+     * @param dy - either 1 or -1
+     * @param goal
+     * @return std::optional<Location> - jump point, empty if jump hit a wall
+     */
+    static std::optional<typename Graph::Location> jumpVertical(
+        const Graph &graph, const typename Graph::Location &from, const int dy, const typename Graph::Location &goal
+    )
+    {
+        typename Graph::Location current = from;
+
+        while (true)
+        {
+            current.y += dy;
+
+            if (!isWalkable(graph, current))
+            {
+                return std::nullopt;
+            }
+
+            if (current == goal)
+            {
+                return current;
+            }
+
+            int x = current.x;
+            int y = current.y;
+
+            // cell to the left or right can only be reached through `current`
+            if ((isWalkable(graph, {x - 1, y}) && !isWalkable(graph, {x - 1, y - dy}))
+                || (isWalkable(graph, {x + 1, y}) && !isWalkable(graph, {x + 1, y - dy})))
+            {
+                return current;
+            }
+
+            if (jumpHorizontal(graph, current, 1, goal).has_value()
+                || jumpHorizontal(graph, current, -1, goal).has_value())
+            {
+                return current;
+            }
+        }
+    }
+
+    /**
+     * @brief Get directions to jump from `current` that was reached from
+     * `parent`
+     *
+     * @param graph
+     * @param current
+     * @param parent - same as `current` for the start location
+     * @return Graph::NeighborList - unit directions
+     */
+    static typename Graph::NeighborList directions(
+        const Graph &graph, const typename Graph::Location &current, const typename Graph::Location &parent
+    )
+    {
+        typename Graph::NeighborList result;
+
+        int dx = (current.x > parent.x) - (current.x < parent.x);
+        int dy = (current.y > parent.y) - (current.y < parent.y);
+
+        typename Graph::NeighborList candidates;
+
+        if (dx == 0 && dy == 0)
+        {
+            candidates.push_back({1, 0});
+            candidates.push_back({-1, 0});
+            candidates.push_back({0, -1});
+            candidates.push_back({0, 1});
+        }
+        else if (dx != 0)
+        {
+            candidates.push_back({0, -1});
+            candidates.push_back({0, 1});
+            candidates.push_back({dx, 0});
+        }
+        else
+        {
+            candidates.push_back({-1, 0});
+            candidates.push_back({1, 0});
+            candidates.push_back({0, dy});
+        }
+
+        for (const typename Graph::Location &direction : candidates)
+        {
+            if (isWalkable(graph, {current.x + direction.x, current.y + direction.y}))
+            {
+                result.push_back(direction);
+            }
+        }
+
+        return result;
+    }
+
+  public:
+    /**
+     * @brief Search a path from `start` to `goal` in a graph
+     *
+     * @param graph - graph to search
+     * @param start
+     * @param goal
+     * @param heuristic - heuristic to determine distance from the goal
+     * @param record - list of jump points expanded by the algorithm. Saves
+     * location (`Location`), time taken (`std::chrono::microseconds`), and a
+     * cost of location (`Graph::cost_t`)
+     *
+     * @return std::vector<Location> - path from `start` to `goal`
+     */
+    static std::vector<typename Graph::Location> search(
+        const Graph                                                                              &graph,
+        const typename Graph::Location                                                           &start,
+        const typename Graph::Location                                                           &goal,
+        std::function<typename Graph::cost_t(typename Graph::Location, typename Graph::Location)> heuristic,
+        std::vector<typename Graph::ChangeRecord>                                                &record
+    )
+    {
+        DenseSearchState<Graph> state(graph.size());
+        Frontier                frontier;
+
+        typename Graph::index_t start_index = graph.index(start);
+        typename Graph::index_t goal_index  = graph.index(goal);
+
+        frontier.push(start_index, typename Graph::cost_t(0));
+        state.set(start_index, typename Graph::cost_t(0), start_index);
+
+        Timer timer;
+
+        while (!frontier.empty())
+        {
+            typename Graph::index_t  current_index = frontier.pop();
+            typename Graph::Location current       = graph.location(current_index);
+            typename Graph::Location parent        = graph.location(state.parent(current_index));
+
+            timer.tock();
+            record.push_back({current, timer.duration(), 0, state.cost(current_index)});
+
+            if (current_index == goal_index)
+            {
+                break;
+            }
+
+            for (const typename Graph::Location &direction : directions(graph, current, parent))
+            {
+                std::optional<typename Graph::Location> jump_point
+                    = direction.x != 0 ? jumpHorizontal(graph, current, direction.x, goal)
+                                       : jumpVertical(graph, current, direction.y, goal);
+
+                if (!jump_point.has_value())
+                {
+                    continue;
+                }
+
+                typename Graph::Location next       = jump_point.value();
+                typename Graph::index_t  next_index = graph.index(next);
+
+                // every step of a straight jump has the same cost
+                typename Graph::cost_t new_cost
+                    = state.cost(current_index)
+                      + (typename Graph::cost_t)(std::abs(next.x - current.x) + std::abs(next.y - current.y))
+                            * graph.cost(current, {current.x + direction.x, current.y + direction.y});
+
+                if (!state.isVisited(next_index) || new_cost < state.cost(next_index))
+                {
+                    state.set(next_index, new_cost, current_index);
+                    typename Graph::cost_t priority = new_cost + heuristic(next, goal);
+                    frontier.push(next_index, priority);
+                }
+            }
+        }
+
+        std::vector<typename Graph::Location> jump_points
+            = JumpPointSearch::reconstruct_path(graph, start, goal, state);
+
+        if (jump_points.empty())
+        {
+            return jump_points;
+        }
+
+        // fill straight lines between jump points
+        std::vector<typename Graph::Location> path{jump_points.front()};
+
+        for (size_t i = 1; i < jump_points.size(); i++)
+        {
+            typename Graph::Location current = jump_points[i - 1];
+
+            int dx = (jump_points[i].x > current.x) - (jump_points[i].x < current.x);
+            int dy = (jump_points[i].y > current.y) - (jump_points[i].y < current.y);
+
+            while (current != jump_points[i])
+            {
+                current.x += dx;
+                current.y += dy;
+                path.push_back(current);
+            }
+        }
+
+        return path;
+    }
+};
@@ -0,0 +1,296 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "algorithm/pathfinder/delta_stepping_search.h"
+#include "utility/thread_pool.h"
+
+/**
+ * Landmark heuristic for A* (ALT: A*, landmarks, triangle inequality). A few
+ * landmark locations are picked far from each other, and exact costs from
+ * every landmark to every location are saved. For any landmark `l` the cost
+ * from `a` to `b` is at least `|d(l, a) - d(l, b)|`, so the largest such
+ * difference is a consistent heuristic, much closer to the real cost than
+ * `Graph::heuristic` in mazes.
+ *
+ * Each landmark is the location farthest from all landmarks picked before it,
+ * and its costs are found by a delta-stepping search on the pool. Costs are
+ * kept location-major, all landmarks of a location next to each other, as
+ * 16-bit values when the largest cost fits, and as `Graph::cost_t` otherwise.
+ *
+ * Heuristic keeps a reference to the graph, so costs must be symmetric and
+ * must not change while it is used
+ *
+ * @tparam Graph - graph with symmetric costs, `isPassable` and static `heuristic`
+ */
+template <typename Graph> class Landmarks
+{
+  public:
+    /** Cost from a landmark to a location it cannot reach */
+    static constexpr typename Graph::cost_t UNREACHABLE = DeltaSteppingSearch<Graph>::UNREACHABLE;
+
+    /**
+     * @brief Construct a new Landmarks object and find costs from `amount`
+     * landmarks of `graph`
+     *
+     * @param graph
+     * @param amount - amount of landmarks
+     * @param pool - workers to search costs on
+     */
+    Landmarks(const Graph &graph, const size_t amount, ThreadPool &pool) : graph(graph)
+    {
+        if (amount == 0)
+        {
+            throw std::invalid_argument("Argument exception: Cannot build landmarks. Amount must be greater than 0.");
+        }
+
+        // first landmark is the farthest location from the first passable one
+        typename Graph::index_t seed = 0;
+
+        while (seed < graph.size() && !graph.isPassable(graph.location(seed)))
+        {
+            seed++;
+        }
+
+        if (seed == graph.size())
+        {
+            return; // nothing to pick landmarks from
+        }
+
+        std::vector<typename Graph::cost_t> nearest
+            = DeltaSteppingSearch<Graph>::distances(graph, graph.location(seed), pool);
+
+        std::vector<std::vector<typename Graph::cost_t>> costs;
+
+        while (this->landmarks.size() < amount)
+        {
+            typename Graph::index_t farthest = seed;
+
+            for (typename Graph::index_t index = 0; index < nearest.size(); index++)
+            {
+                if (nearest[index] != Landmarks::UNREACHABLE && nearest[index] > nearest[farthest])
+                {
+                    farthest = index;
+                }
+            }
+
+            // every reachable location is a landmark already
+            if (nearest[farthest] == 0 && !this->landmarks.empty())
+            {
+                break;
+            }
+
+            this->landmarks.push_back(farthest);
+            costs.push_back(DeltaSteppingSearch<Graph>::distances(graph, graph.location(farthest), pool));
+
+            for (typename Graph::index_t index = 0; index < nearest.size(); index++)
+            {
+                nearest[index] = std::min(nearest[index], costs.back()[index]);
+            }
+        }
+
+        this->store(costs);
+    }
+
+    /**
+     * @brief Construct a new Landmarks object and find costs from `amount`
+     * landmarks of `graph` on a pool with a worker per core
+     *
+     * @param graph
+     * @param amount - amount of landmarks
+     */
+    Landmarks(const Graph &graph, const size_t amount = 8) : Landmarks(graph, amount, ThreadPool::shared())
+    {
+    }
+
+    /**
+     * @brief Get amount of landmarks
+     *
+     * @return size_t
+     */
+    inline size_t size() const
+    {
+        return this->landmarks.size();
+    }
+
+    /**
+     * @brief Check if costs are kept as 16-bit values
+     *
+     * @return true
+     * @return false
+     */
+    inline bool isNarrow() const
+    {
+        return this->wide.empty();
+    }
+
+    /**
+     * @brief Get locations of landmarks
+     *
+     * @return std::vector<Location>
+     */
+    std::vector<typename Graph::Location> locations() const
+    {
+        std::vector<typename Graph::Location> result;
+
+        for (typename Graph::index_t landmark : this->landmarks)
+        {
+            result.push_back(this->graph.location(landmark));
+        }
+
+        return result;
+    }
+
+    /**
+     * @brief Estimate cost from `from` to `to`. Never higher than the real
+     * cost and never lower than `Graph::heuristic`
+     *
+     * @param from
+     * @param to
+     * @return Graph::cost_t
+     */
+    typename Graph::cost_t estimate(const typename Graph::Location &from, const typename Graph::Location &to) const
+    {
+        typename Graph::cost_t best = Graph::heuristic(from, to);
+
+        if (this->isNarrow())
+        {
+            return std::max(best, this->bound(this->narrow, from, to));
+        }
+
+        return std::max(best, this->bound(this->wide, from, to));
+    }
+
+    /**
+     * @brief Estimate cost from `from` to `to`, so landmarks can be passed to
+     * `AStarSearch` as a heuristic policy
+     *
+     * @param from
+     * @param to
+     * @return Graph::cost_t
+     */
+    inline typename Graph::cost_t operator()(
+        const typename Graph::Location &from, const typename Graph::Location &to
+    ) const
+    {
+        return this->estimate(from, to);
+    }
+
+    /**
+     * @brief Get heuristic for `AStarSearch`. Landmarks must outlive it
+     *
+     * @return std::function<Graph::cost_t(Location, Location)>
+     */
+    std::function<typename Graph::cost_t(typename Graph::Location, typename Graph::Location)> heuristic() const
+    {
+        return [this](typename Graph::Location from, typename Graph::Location to) {
+            return this->estimate(from, to);
+        };
+    }
+
+  private:
+    /** Cost that marks unreachable location in 16-bit costs */
+    static constexpr uint16_t NARROW_UNREACHABLE = std::numeric_limits<uint16_t>::max();
+
+    const Graph &graph;
+
+    std::vector<typename Graph::index_t> landmarks;
+
+    /** Costs by `index * size() + landmark`, only one of them is filled */
+    std::vector<uint16_t>               narrow;
+    std::vector<typename Graph::cost_t> wide;
+
+    /**
+     * @brief Interleave costs of every landmark into 16-bit costs if the
+     * largest one fits, into `Graph::cost_t` costs otherwise
+     *
+     * @param costs - costs by location index, one list per landmark
+     */
+    void store(const std::vector<std::vector<typename Graph::cost_t>> &costs)
+    {
+        size_t amount = costs.size();
+        bool   fits   = true;
+
+        for (const std::vector<typename Graph::cost_t> &landmark_costs : costs)
+        {
+            for (typename Graph::cost_t cost : landmark_costs)
+            {
+                fits = fits && (cost == Landmarks::UNREACHABLE || cost < Landmarks::NARROW_UNREACHABLE);
+            }
+        }
+
+        if (fits)
+        {
+            this->narrow.resize(this->graph.size() * amount);
+        }
+        else
+        {
+            this->wide.resize(this->graph.size() * amount);
+        }
+
+        for (size_t landmark = 0; landmark < amount; landmark++)
+        {
+            for (size_t index = 0; index < this->graph.size(); index++)
+            {
+                typename Graph::cost_t cost = costs[landmark][index];
+
+                if (fits)
+                {
+                    this->narrow[index * amount + landmark]
+                        = cost == Landmarks::UNREACHABLE ? Landmarks::NARROW_UNREACHABLE : (uint16_t)cost;
+                }
+                else
+                {
+                    this->wide[index * amount + landmark] = cost;
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Get the largest triangle inequality bound of cost from `from` to
+     * `to` over all landmarks
+     *
+     * @tparam T - type of stored costs
+     * @param costs
+     * @param from
+     * @param to
+     * @return Graph::cost_t
+     */
+    template <typename T>
+    typename Graph::cost_t bound(
+        const std::vector<T> &costs, const typename Graph::Location &from, const typename Graph::Location &to
+    ) const
+    {
+        const T unreachable = std::numeric_limits<T>::max();
+
+        size_t amount = this->landmarks.size();
+
+        const T *from_costs = costs.data() + this->graph.index(from) * amount;
+        const T *to_costs   = costs.data() + this->graph.index(to) * amount;
+
+        typename Graph::cost_t best = 0;
+
+        for (size_t landmark = 0; landmark < amount; landmark++)
+        {
+            // landmark in another component tells nothing
+            if (from_costs[landmark] == unreachable || to_costs[landmark] == unreachable)
+            {
+                continue;
+            }
+
+            typename Graph::cost_t difference = from_costs[landmark] > to_costs[landmark]
+                                                  ? from_costs[landmark] - to_costs[landmark]
+                                                  : to_costs[landmark] - from_costs[landmark];
+
+            best = std::max(best, difference);
+        }
+
+        return best;
+    }
+};
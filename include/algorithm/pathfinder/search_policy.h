@@ -0,0 +1,110 @@
+#pragma once
+
+/**
+ * Heuristics, costs and connectivity that are passed to searches as template
+ * arguments, so the compiler can inline them instead of calling through
+ * `std::function`. Every policy is a functor that takes two locations
+ */
+
+/**
+ * Manhattan distance, exact on 4-connected grids without walls
+ *
+ * @tparam Graph - graph with `Location` that has `x` and `y`
+ */
+template <typename Graph> struct ManhattanHeuristic
+{
+    constexpr typename Graph::cost_t operator()(
+        const typename Graph::Location &from, const typename Graph::Location &to
+    ) const
+    {
+        // `std::abs` is not constexpr
+        return (typename Graph::cost_t)((from.x > to.x ? from.x - to.x : to.x - from.x)
+                                        + (from.y > to.y ? from.y - to.y : to.y - from.y));
+    }
+};
+
+/**
+ * Heuristic that knows nothing, turns A* into Dijkstra
+ *
+ * @tparam Graph
+ */
+template <typename Graph> struct ZeroHeuristic
+{
+    constexpr typename Graph::cost_t operator()(
+        const typename Graph::Location &, const typename Graph::Location &
+    ) const
+    {
+        return typename Graph::cost_t(0);
+    }
+};
+
+/**
+ * Octile distance, exact on 8-connected grids without walls, where a diagonal
+ * step costs `sqrt(2)`. Rounded down, so it stays admissible for integer costs
+ * and never exceeds Manhattan distance
+ *
+ * @tparam Graph - graph with `Location` that has `x` and `y`
+ */
+template <typename Graph> struct OctileHeuristic
+{
+    constexpr typename Graph::cost_t operator()(
+        const typename Graph::Location &from, const typename Graph::Location &to
+    ) const
+    {
+        long dx = from.x > to.x ? from.x - to.x : to.x - from.x;
+        long dy = from.y > to.y ? from.y - to.y : to.y - from.y;
+
+        long straight = dx > dy ? dx : dy;
+        long diagonal = dx > dy ? dy : dx;
+
+        // sqrt(2) - 1 in fixed point
+        return (typename Graph::cost_t)(straight + diagonal * 41421 / 100000);
+    }
+};
+
+/**
+ * Cost of a step as the graph reports it
+ *
+ * @tparam Graph
+ */
+template <typename Graph> struct GraphCost
+{
+    const Graph &graph;
+
+    inline typename Graph::cost_t operator()(
+        const typename Graph::Location &from, const typename Graph::Location &to
+    ) const
+    {
+        return this->graph.cost(from, to);
+    }
+};
+
+/**
+ * Cost of a step on a graph where every step costs the same
+ *
+ * @tparam Graph
+ */
+template <typename Graph> struct UnitCost
+{
+    constexpr typename Graph::cost_t operator()(
+        const typename Graph::Location &, const typename Graph::Location &
+    ) const
+    {
+        return typename Graph::cost_t(1);
+    }
+};
+
+/**
+ * Connectivity that knows nothing, every location may reach every other one,
+ * so no search is rejected before it starts. See `ConnectivityIndex` for one
+ * that knows components of a grid
+ *
+ * @tparam Graph
+ */
+template <typename Graph> struct FullConnectivity
+{
+    constexpr bool operator()(const typename Graph::Location &, const typename Graph::Location &) const
+    {
+        return true;
+    }
+};
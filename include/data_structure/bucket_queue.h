@@ -0,0 +1,132 @@
+#pragma once
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/**
+ * Monotone bucket queue (Dial's algorithm). Has the same interface as
+ * `PriorityQueue`, but priority of pushed item must not be lower than priority
+ * of the last popped item, which holds for Dijkstra and for A* with a
+ * consistent heuristic. Priorities must be non-negative integers
+ */
+template <typename T, typename priority_t> class BucketQueue
+{
+  private:
+    std::vector<std::vector<T>> buckets = std::vector<std::vector<T>>(16);
+
+    priority_t current = priority_t(0);
+    size_t     count   = 0;
+
+    /**
+     * @brief Get bucket in which items with `priority` are stored
+     *
+     * @param priority
+     * @return std::vector<T>&
+     */
+    inline std::vector<T> &bucket(const priority_t priority)
+    {
+        return this->buckets[(size_t)priority & (this->buckets.size() - 1)];
+    }
+
+    /**
+     * @brief Grow ring of buckets, so it can hold priorities up to `priority`
+     *
+     * @param priority
+     */
+    void grow(const priority_t priority)
+    {
+        size_t size = this->buckets.size();
+
+        while ((size_t)(priority - this->current) >= size)
+        {
+            size *= 2;
+        }
+
+        std::vector<std::vector<T>> grown(size);
+
+        for (size_t offset = 0; offset < this->buckets.size(); offset++)
+        {
+            priority_t bucket_priority = this->current + (priority_t)offset;
+            grown[(size_t)bucket_priority & (size - 1)].swap(this->bucket(bucket_priority));
+        }
+
+        this->buckets.swap(grown);
+    }
+
+  public:
+    /**
+     * @brief Check if queue is empty
+     *
+     * @return true
+     * @return false
+     */
+    inline bool empty() const
+    {
+        return this->count == 0;
+    }
+
+    /**
+     * @brief Put `item` with `priority` into queue
+     *
+     * @param item
+     * @param priority
+     */
+    inline void push(T item, priority_t priority)
+    {
+        if (priority < this->current)
+        {
+            throw std::invalid_argument(
+                "Bucket queue exception: Cannot push to bucket queue. Priority " + std::to_string(priority)
+                + " is lower than priority of the last popped item " + std::to_string(this->current) + "."
+            );
+        }
+
+        if ((size_t)(priority - this->current) >= this->buckets.size())
+        {
+            this->grow(priority);
+        }
+
+        this->bucket(priority).push_back(item);
+        this->count++;
+    }
+
+    /**
+     * @brief Remove all items, keeping allocated buckets for reuse
+     *
+     */
+    void clear()
+    {
+        for (std::vector<T> &bucket : this->buckets)
+        {
+            bucket.clear();
+        }
+
+        this->current = priority_t(0);
+        this->count   = 0;
+    }
+
+    /**
+     * @brief Gets `item` with the lowest priority
+     *
+     * @return T
+     */
+    T pop()
+    {
+        if (this->empty())
+        {
+            throw std::out_of_range("Out of range exception: Cannot pop from bucket queue. Bucket queue is empty.");
+        }
+
+        while (this->bucket(this->current).empty())
+        {
+            this->current++;
+        }
+
+        std::vector<T> &bucket    = this->bucket(this->current);
+        T               best_item = bucket.back();
+        bucket.pop_back();
+        this->count--;
+        return best_item;
+    }
+};
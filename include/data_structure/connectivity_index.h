@@ -0,0 +1,139 @@
+#pragma once
+
+#include <limits>
+#include <vector>
+
+#include "data_structure/grid.h"
+
+/**
+ * Connected components of the passable cells of a `Grid`, kept in a
+ * union-find forest with union by size. Checking if two cells are connected
+ * walks two trees of logarithmic height at most, so searches can reject a goal
+ * that cannot be reached before expanding anything.
+ *
+ * Opened cells are merged into the components around them as they change.
+ * Union-find cannot split a component, so a closed cell rebuilds the whole
+ * index. Index keeps a reference to the grid and must be updated after the
+ * grid changes
+ */
+class ConnectivityIndex
+{
+  public:
+    /** Parent of a cell that is not passable */
+    static constexpr Grid::index_t NONE = std::numeric_limits<Grid::index_t>::max();
+
+    const Grid &grid;
+
+    /**
+     * @brief Construct a new Connectivity Index object of `grid` and build it
+     *
+     * @param grid
+     */
+    explicit ConnectivityIndex(const Grid &grid);
+
+    /** Find components of the whole grid again */
+    void build();
+
+    /**
+     * @brief Update components after cells at `changed` changed their type,
+     * e.g. with locations returned by `Grid::apply`
+     *
+     * @param changed
+     */
+    void update(const std::vector<Grid::Location> &changed);
+
+    /**
+     * @brief Get index of the cell that represents the component of
+     * `location`
+     *
+     * @param location
+     * @return Grid::index_t - `NONE` if cell is not passable
+     */
+    Grid::index_t component(const Grid::Location &location) const;
+
+    /**
+     * @brief Check if a path between `from` and `to` exists
+     *
+     * @param from
+     * @param to
+     * @return true
+     * @return false - if cells are in different components or either is not
+     * passable
+     */
+    inline bool isConnected(const Grid::Location &from, const Grid::Location &to) const
+    {
+        Grid::index_t component = this->component(from);
+        return component != ConnectivityIndex::NONE && component == this->component(to);
+    }
+
+    /**
+     * @brief Check if a path between `from` and `to` exists, so the index can
+     * be passed to searches as a connectivity policy
+     *
+     * @param from
+     * @param to
+     * @return true
+     * @return false
+     */
+    inline bool operator()(const Grid::Location &from, const Grid::Location &to) const
+    {
+        return this->isConnected(from, to);
+    }
+
+    /**
+     * @brief Get amount of cells in the component of `location`
+     *
+     * @param location
+     * @return size_t - 0 if cell is not passable
+     */
+    size_t componentSize(const Grid::Location &location) const;
+
+    /**
+     * @brief Get amount of components
+     *
+     * @return size_t
+     */
+    inline size_t size() const
+    {
+        return this->count;
+    }
+
+    /**
+     * @brief Get amount of cells of every component, largest first
+     *
+     * @return std::vector<size_t>
+     */
+    std::vector<size_t> componentSizes() const;
+
+  private:
+    std::vector<Grid::index_t> parents;
+
+    /** Amount of cells of a component, valid for roots only */
+    std::vector<Grid::index_t> sizes;
+
+    size_t count = 0;
+
+    /**
+     * @brief Get root of the tree of a passable cell with `index`
+     *
+     * @param index
+     * @return Grid::index_t
+     */
+    Grid::index_t find(Grid::index_t index) const;
+
+    /**
+     * @brief Merge components of passable cells with indices `a` and `b`
+     *
+     * @param a
+     * @param b
+     */
+    void unite(const Grid::index_t a, const Grid::index_t b);
+
+    /**
+     * @brief Add a passable cell at `location` as a component of its own and
+     * merge it with components of its passable neighbors
+     *
+     * @param location
+     */
+    void open(const Grid::Location &location);
+};
@@ -0,0 +1,163 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "data_structure/grid.h"
+
+/**
+ * Weighted graph of a `Grid` with 1-wide corridors contracted. Nodes are
+ * junctions, dead ends and query endpoints, edges are corridors between them
+ * labeled with their length. Has the same interface as `Grid`, so pathfinders
+ * parameterised on `Graph` can search it, and `expand` turns a path of nodes
+ * back into cells.
+ *
+ * Graph keeps a reference to the grid and must be rebuilt after the grid
+ * changes
+ */
+class CorridorGraph
+{
+  public:
+    typedef Grid::cost_t       cost_t;
+    typedef Grid::index_t      index_t;
+    typedef Grid::Location     Location;
+    typedef Grid::ChangeRecord ChangeRecord;
+    typedef Grid::NeighborList NeighborList;
+
+    /** Node index of a cell that is not a node */
+    static constexpr index_t NONE = std::numeric_limits<index_t>::max();
+
+    /** Corridor from a node */
+    struct Edge
+    {
+        index_t to;
+        cost_t  cost;
+
+        /** Index in `Grid::directions` of the first step of the corridor */
+        uint8_t direction;
+    };
+
+    const Grid &grid;
+
+    /**
+     * @brief Construct a new Corridor Graph object of `grid`
+     *
+     * @param grid
+     * @param endpoints - passable cells that must be nodes, e.g. start and goal
+     * of queries
+     */
+    CorridorGraph(const Grid &grid, const std::vector<Grid::Location> &endpoints = {});
+
+    /**
+     * @brief Get amount of nodes
+     *
+     * @return size_t
+     */
+    inline size_t size() const
+    {
+        return this->nodes.size();
+    }
+
+    /**
+     * @brief Check if cell at `location` is a node
+     *
+     * @param location
+     * @return true
+     * @return false
+     */
+    inline bool isNode(const Grid::Location &location) const
+    {
+        return this->node_ids[this->grid.index(location)] != CorridorGraph::NONE;
+    }
+
+    /**
+     * @brief Get node index of `location`, location must be a node
+     *
+     * @param location
+     * @return index_t
+     */
+    inline index_t index(const Grid::Location &location) const
+    {
+        return this->node_ids[this->grid.index(location)];
+    }
+
+    /**
+     * @brief Get location of the node with `index`
+     *
+     * @param index
+     * @return Grid::Location
+     */
+    inline Grid::Location location(const index_t index) const
+    {
+        return this->nodes[index];
+    }
+
+    /**
+     * @brief Get corridors from the node at `location`
+     *
+     * @param location
+     * @return const std::vector<Edge>&
+     */
+    inline const std::vector<CorridorGraph::Edge> &edges(const Grid::Location &location) const
+    {
+        return this->adjacency[this->index(location)];
+    }
+
+    /**
+     * @brief Find nodes at the other end of corridors from the node at
+     * `location`
+     *
+     * @param location
+     * @return Grid::NeighborList
+     */
+    Grid::NeighborList neighbors(const Grid::Location &location) const;
+
+    /**
+     * @brief Return length of the shortest corridor between nodes `from` and
+     * `to`
+     *
+     * @param from
+     * @param to
+     * @return cost_t
+     */
+    cost_t cost(const Grid::Location &from, const Grid::Location &to) const;
+
+    /**
+     * @brief Calculate a distance between locations `from` and `to`. Corridors
+     * are never shorter, so it stays consistent
+     *
+     * @param from
+     * @param to
+     * @return cost_t
+     */
+    static cost_t heuristic(const Grid::Location &from, const Grid::Location &to);
+
+    /**
+     * @brief Expand path of nodes into a path of cells
+     *
+     * @param path - path of nodes, as returned by a pathfinder
+     * @return std::vector<Grid::Location>
+     */
+    std::vector<Grid::Location> expand(const std::vector<Grid::Location> &path) const;
+
+  private:
+    /** Location of every node */
+    std::vector<Grid::Location> nodes;
+
+    /** Node index of every cell, `NONE` if cell is not a node */
+    std::vector<index_t> node_ids;
+
+    /** Corridors from every node, at most one to each other node */
+    std::vector<std::vector<CorridorGraph::Edge>> adjacency;
+
+    /**
+     * @brief Get the next cell of a corridor after `current` that was entered
+     * from `previous`
+     *
+     * @param current
+     * @param previous
+     * @return Grid::Location
+     */
+    Grid::Location follow(const Grid::Location &current, const Grid::Location &previous) const;
+};
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+/**
+ * Cost and parent of every location of a graph, kept in a flat array indexed
+ * by location index. Location is visited only while its stamp equals the
+ * current generation, so starting a new search marks every location as not
+ * visited without touching the array
+ *
+ * @tparam Graph
+ */
+template <typename Graph> class DenseSearchState
+{
+  public:
+    typedef typename Graph::index_t index_t;
+    typedef typename Graph::cost_t  cost_t;
+
+    /** Parent of a location that was not visited yet */
+    static constexpr index_t NONE = std::numeric_limits<index_t>::max();
+
+  private:
+    /** Way to a location, kept together so a step reads a single cache line */
+    struct Way
+    {
+        cost_t   cost;
+        index_t  parent;
+        uint32_t generation;
+    };
+
+    std::vector<Way> ways;
+    uint32_t         generation = 1;
+
+  public:
+    /**
+     * @brief Construct a new Dense Search State object for a graph with `size`
+     * locations, none of them visited
+     *
+     * @param size
+     */
+    explicit DenseSearchState(const size_t size) : ways(size, Way{cost_t(0), NONE, 0})
+    {
+    }
+
+    /**
+     * @brief Mark every location of a graph with `size` locations as not
+     * visited, keeping allocated memory for reuse. Takes constant time unless
+     * `size` changes
+     *
+     * @param size
+     */
+    void reset(const size_t size)
+    {
+        // new ways have a generation older than any current one
+        this->ways.resize(size, Way{cost_t(0), NONE, 0});
+
+        if (++this->generation == 0)
+        {
+            // counter wrapped around, old ways could be taken for the new generation
+            this->ways.assign(size, Way{cost_t(0), NONE, 0});
+            this->generation = 1;
+        }
+    }
+
+    /**
+     * @brief Check if location with `index` was reached by the search
+     *
+     * @param index
+     * @return true
+     * @return false
+     */
+    inline bool isVisited(const index_t index) const
+    {
+        return this->ways[index].generation == this->generation;
+    }
+
+    /**
+     * @brief Get cost of the best known way to location with `index`
+     *
+     * @param index
+     * @return cost_t
+     */
+    inline cost_t cost(const index_t index) const
+    {
+        return this->ways[index].cost;
+    }
+
+    /**
+     * @brief Get location index from which location with `index` was reached
+     *
+     * @param index
+     * @return index_t
+     */
+    inline index_t parent(const index_t index) const
+    {
+        return this->ways[index].parent;
+    }
+
+    /**
+     * @brief Save a better way to location with `index`
+     *
+     * @param index
+     * @param cost
+     * @param parent
+     */
+    inline void set(const index_t index, const cost_t cost, const index_t parent)
+    {
+        this->ways[index] = {cost, parent, this->generation};
+    }
+};
@@ -3,6 +3,9 @@
 #include <algorithm>
 #include <array>
 #include <chrono>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -12,6 +15,9 @@ class Grid
     /** Type of cost of the cell */
     typedef unsigned cost_t;
 
+    /** Type of linear index of the cell */
+    typedef uint32_t index_t;
+
     /** Position of each cell in a grid */
     class Location
     {
@@ -39,10 +45,78 @@ class Grid
         WALL
     };
 
+    /** Change of a single cell, applied by `Grid::apply` */
+    struct CellChange
+    {
+        Grid::Location location;
+        Grid::CellType type;
+    };
+
+    /** Reference to a single cell of the bit-packed grid storage */
+    class CellReference
+    {
+      public:
+        CellReference(uint64_t &word, const uint64_t mask);
+
+        CellReference &operator=(const Grid::CellType type);
+        operator Grid::CellType() const;
+
+      private:
+        uint64_t &word;
+        uint64_t  mask;
+    };
+
+    /** Fixed-capacity list of neighbors of a cell, never allocates */
+    class NeighborList
+    {
+      public:
+        inline void push_back(const Grid::Location &location)
+        {
+            this->items[this->count++] = location;
+        }
+
+        inline const Grid::Location *begin() const
+        {
+            return this->items.data();
+        }
+
+        inline const Grid::Location *end() const
+        {
+            return this->items.data() + this->count;
+        }
+
+        inline size_t size() const
+        {
+            return this->count;
+        }
+
+        inline bool empty() const
+        {
+            return this->count == 0;
+        }
+
+        inline const Grid::Location &operator[](const size_t index) const
+        {
+            return this->items[index];
+        }
+
+      private:
+        std::array<Grid::Location, 4> items;
+        size_t                        count = 0;
+    };
+
     static const std::array<Grid::Location, 4> directions;
 
-    size_t                                   width, height;
-    std::vector<std::vector<Grid::CellType>> grid;
+    size_t width, height;
+
+    /** Amount of 64-bit words in a row. Rows are padded to the word boundary */
+    size_t row_words;
+
+    /**
+     * Row-major bit mask of the grid, set bit means that cell is `EMPTY`.
+     * Padding bits at the end of the row are never set
+     */
+    std::vector<uint64_t> cells;
 
     /**
      * @brief Construct a new Grid object with dimensions `width` x `height` of
@@ -60,7 +134,11 @@ class Grid
      * @return true
      * @return false
      */
-    bool isInBounds(const Grid::Location &location) const;
+    inline bool isInBounds(const Grid::Location &location) const
+    {
+        return 0 <= location.x && (size_t)location.x < this->width && 0 <= location.y
+               && (size_t)location.y < this->height;
+    }
 
     /**
      * @brief Check if `location` is passable
@@ -69,7 +147,58 @@ class Grid
      * @return true
      * @return false
      */
-    bool isPassable(const Grid::Location &location) const;
+    inline bool isPassable(const Grid::Location &location) const
+    {
+        return (this->cells[location.y * this->row_words + (location.x >> 6)] >> (location.x & 63)) & 1;
+    }
+
+    /**
+     * @brief Get amount of cells in the grid
+     *
+     * @return size_t
+     */
+    inline size_t size() const
+    {
+        return this->width * this->height;
+    }
+
+    /**
+     * @brief Get linear row-major index of `location`
+     *
+     * @param location
+     * @return Grid::index_t
+     */
+    inline Grid::index_t index(const Grid::Location &location) const
+    {
+        return (Grid::index_t)(location.y * this->width + location.x);
+    }
+
+    /**
+     * @brief Get location of the cell with linear `index`
+     *
+     * @param index
+     * @return Grid::Location
+     */
+    inline Grid::Location location(const Grid::index_t index) const
+    {
+        return Grid::Location{(int)(index % this->width), (int)(index / this->width)};
+    }
+
+    /**
+     * @brief Set every cell of the grid to `type`
+     *
+     * @param type
+     */
+    void fill(const Grid::CellType type);
+
+    /**
+     * @brief Apply a batch of cell changes
+     *
+     * @param changes
+     * @return std::vector<Grid::Location> - locations whose type was changed,
+     * can be passed to incremental pathfinders
+     */
+    std::vector<Grid::Location> apply(const std::vector<Grid::CellChange> &changes);
 
     /**
      * @brief Find all passable (or not passable) neighbors within a given
@@ -78,9 +207,9 @@ class Grid
      * @param location
      * @param distance
      * @param passable
-     * @return std::vector<Grid::Location>
+     * @return Grid::NeighborList
      */
-    std::vector<Grid::Location> neighbors(
+    Grid::NeighborList neighbors(
         const Grid::Location &location, const unsigned distance = 0, const bool is_passable = true
     ) const;
 
@@ -102,7 +231,19 @@ class Grid
      */
     static Grid::cost_t heuristic(const Grid::Location &from, const Grid::Location &to);
 
-    Grid::CellType &operator[](const Grid::Location &location);
+    Grid::CellReference operator[](const Grid::Location &location);
+    Grid::CellType      operator[](const Grid::Location &location) const;
+
+  private:
+    /**
+     * @brief Check that a grid of `width` x `height` can be indexed, before
+     * its cells are allocated
+     *
+     * @param width
+     * @param height
+     * @return size_t - `width`
+     */
+    static size_t checkSize(const size_t width, const size_t height);
 };
 
 namespace std
@@ -0,0 +1,218 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+/**
+ * Open addressing hash table with linear probing, for searches that keep
+ * state of visited locations only instead of every location of a graph.
+ * Capacity is a power of two and doubles once the table is half full, so
+ * memory grows with the amount of keys. Erasing shifts the following keys
+ * back instead of leaving tombstones.
+ *
+ * Inserting may move values, so pointers and references to them are valid
+ * only until the next insertion. Keys must be unsigned integral indices
+ * other than `EMPTY`
+ *
+ * @tparam Key
+ * @tparam Value
+ */
+template <typename Key, typename Value> class HashTable
+{
+  public:
+    /** Key of an empty slot */
+    static constexpr Key EMPTY = std::numeric_limits<Key>::max();
+
+  private:
+    std::vector<Key>   keys;
+    std::vector<Value> values;
+    size_t             count = 0;
+
+    /**
+     * @brief Get first slot probed for `key`
+     *
+     * @param key
+     * @return size_t
+     */
+    inline size_t home(const Key key) const
+    {
+        // Fibonacci hashing spreads neighboring indices over the table
+        return (size_t)((uint64_t(key) * 0x9E3779B97F4A7C15ull) >> 32) & (this->keys.size() - 1);
+    }
+
+    /**
+     * @brief Get slot of `key`, or the empty slot where it would be inserted
+     *
+     * @param key
+     * @return size_t
+     */
+    inline size_t probe(const Key key) const
+    {
+        size_t slot = this->home(key);
+
+        while (this->keys[slot] != key && this->keys[slot] != HashTable::EMPTY)
+        {
+            slot = (slot + 1) & (this->keys.size() - 1);
+        }
+
+        return slot;
+    }
+
+    /** Double capacity and insert every key again */
+    void grow()
+    {
+        std::vector<Key>   old_keys   = std::move(this->keys);
+        std::vector<Value> old_values = std::move(this->values);
+
+        this->keys.assign(old_keys.size() * 2, HashTable::EMPTY);
+        this->values.assign(old_keys.size() * 2, Value());
+
+        for (size_t slot = 0; slot < old_keys.size(); slot++)
+        {
+            if (old_keys[slot] != HashTable::EMPTY)
+            {
+                size_t new_slot        = this->probe(old_keys[slot]);
+                this->keys[new_slot]   = old_keys[slot];
+                this->values[new_slot] = std::move(old_values[slot]);
+            }
+        }
+    }
+
+  public:
+    /**
+     * @brief Construct a new Hash Table object with room for `capacity` keys
+     * before it grows
+     *
+     * @param capacity
+     */
+    explicit HashTable(const size_t capacity = 16)
+    {
+        size_t slots = 2;
+
+        while (slots < capacity * 2)
+        {
+            slots *= 2;
+        }
+
+        this->keys.assign(slots, HashTable::EMPTY);
+        this->values.assign(slots, Value());
+    }
+
+    /**
+     * @brief Get amount of keys
+     *
+     * @return size_t
+     */
+    inline size_t size() const
+    {
+        return this->count;
+    }
+
+    /**
+     * @brief Get value of `key`
+     *
+     * @param key
+     * @return Value* - `nullptr` if key is not in the table
+     */
+    inline Value *find(const Key key)
+    {
+        size_t slot = this->probe(key);
+        return this->keys[slot] == key ? &this->values[slot] : nullptr;
+    }
+
+    /**
+     * @brief Get value of `key`
+     *
+     * @param key
+     * @return const Value* - `nullptr` if key is not in the table
+     */
+    inline const Value *find(const Key key) const
+    {
+        size_t slot = this->probe(key);
+        return this->keys[slot] == key ? &this->values[slot] : nullptr;
+    }
+
+    /**
+     * @brief Check if `key` is in the table
+     *
+     * @param key
+     * @return true
+     * @return false
+     */
+    inline bool contains(const Key key) const
+    {
+        return this->keys[this->probe(key)] == key;
+    }
+
+    /**
+     * @brief Get value of `key`, inserting a default value if key is not in
+     * the table
+     *
+     * @param key
+     * @return Value&
+     */
+    Value &operator[](const Key key)
+    {
+        size_t slot = this->probe(key);
+
+        if (this->keys[slot] == key)
+        {
+            return this->values[slot];
+        }
+
+        // table is kept at most half full, so probes stay short
+        if ((this->count + 1) * 2 > this->keys.size())
+        {
+            this->grow();
+            slot = this->probe(key);
+        }
+
+        this->keys[slot]   = key;
+        this->values[slot] = Value();
+        this->count++;
+
+        return this->values[slot];
+    }
+
+    /**
+     * @brief Remove `key` from the table
+     *
+     * @param key
+     */
+    void erase(const Key key)
+    {
+        size_t mask = this->keys.size() - 1;
+        size_t slot = this->probe(key);
+
+        if (this->keys[slot] != key)
+        {
+            return;
+        }
+
+        // move back every following key whose probe passes the freed slot
+        for (size_t next = (slot + 1) & mask; this->keys[next] != HashTable::EMPTY; next = (next + 1) & mask)
+        {
+            size_t next_home = this->home(this->keys[next]);
+
+            if (((next - next_home) & mask) >= ((next - slot) & mask))
+            {
+                this->keys[slot]   = this->keys[next];
+                this->values[slot] = std::move(this->values[next]);
+                slot               = next;
+            }
+        }
+
+        this->keys[slot] = HashTable::EMPTY;
+        this->count--;
+    }
+
+    /** Remove every key, keeping allocated memory for reuse */
+    void clear()
+    {
+        std::fill(this->keys.begin(), this->keys.end(), HashTable::EMPTY);
+        this->count = 0;
+    }
+};
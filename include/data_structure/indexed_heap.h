@@ -0,0 +1,236 @@
+#pragma once
+
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * Indexed d-ary min heap. Has the same interface as `PriorityQueue`, but
+ * remembers the slot of every item, so pushing an item that is already in the
+ * heap with a lower priority decreases its key in place instead of adding a
+ * duplicate entry. Items must be unsigned integral indices
+ */
+template <typename T, typename priority_t, size_t arity = 4> class IndexedHeap
+{
+  public:
+    /** Counters of heap operations */
+    struct Counters
+    {
+        size_t pushes        = 0;
+        size_t pops          = 0;
+        size_t decrease_keys = 0; // pushes which would leave a stale entry in `PriorityQueue`
+    };
+
+    Counters counters;
+
+  private:
+    struct Node
+    {
+        priority_t priority;
+        T          item;
+    };
+
+    /** Slot of an item that is not in the heap */
+    static constexpr size_t NONE = std::numeric_limits<size_t>::max();
+
+    std::vector<Node>   nodes;
+    std::vector<size_t> slots;
+
+    /**
+     * @brief Place `node` at `slot` and remember that slot
+     *
+     * @param slot
+     * @param node
+     */
+    inline void place(const size_t slot, const Node &node)
+    {
+        this->nodes[slot]      = node;
+        this->slots[node.item] = slot;
+    }
+
+    /**
+     * @brief Move node at `slot` up until its parent has lower priority
+     *
+     * @param slot
+     */
+    void siftUp(size_t slot)
+    {
+        Node node = this->nodes[slot];
+
+        while (slot > 0)
+        {
+            size_t parent = (slot - 1) / arity;
+
+            if (!(node.priority < this->nodes[parent].priority))
+            {
+                break;
+            }
+
+            this->place(slot, this->nodes[parent]);
+            slot = parent;
+        }
+
+        this->place(slot, node);
+    }
+
+    /**
+     * @brief Move node at `slot` down until all its children have higher
+     * priority
+     *
+     * @param slot
+     */
+    void siftDown(size_t slot)
+    {
+        Node   node = this->nodes[slot];
+        size_t size = this->nodes.size();
+
+        while (true)
+        {
+            size_t first = slot * arity + 1;
+
+            if (first >= size)
+            {
+                break;
+            }
+
+            size_t last = first + arity < size ? first + arity : size;
+            size_t best = first;
+
+            for (size_t child = first + 1; child < last; child++)
+            {
+                if (this->nodes[child].priority < this->nodes[best].priority)
+                {
+                    best = child;
+                }
+            }
+
+            if (!(this->nodes[best].priority < node.priority))
+            {
+                break;
+            }
+
+            this->place(slot, this->nodes[best]);
+            slot = best;
+        }
+
+        this->place(slot, node);
+    }
+
+  public:
+    /**
+     * @brief Check if heap is empty
+     *
+     * @return true
+     * @return false
+     */
+    inline bool empty() const
+    {
+        return this->nodes.empty();
+    }
+
+    /**
+     * @brief Check if `item` is in the heap
+     *
+     * @param item
+     * @return true
+     * @return false
+     */
+    inline bool contains(T item) const
+    {
+        return (size_t)item < this->slots.size() && this->slots[item] != NONE;
+    }
+
+    /**
+     * @brief Put `item` with `priority` into heap. If `item` is already in the
+     * heap, decrease its priority if `priority` is lower
+     *
+     * @param item
+     * @param priority
+     */
+    void push(T item, priority_t priority)
+    {
+        if (this->contains(item))
+        {
+            this->decreaseKey(item, priority);
+            return;
+        }
+
+        if ((size_t)item >= this->slots.size())
+        {
+            this->slots.resize((size_t)item + 1, NONE);
+        }
+
+        this->counters.pushes++;
+        this->nodes.push_back({priority, item});
+        this->siftUp(this->nodes.size() - 1);
+    }
+
+    /**
+     * @brief Decrease priority of `item` that is in the heap to `priority`.
+     * Does nothing if `priority` is not lower than the current one
+     *
+     * @param item
+     * @param priority
+     */
+    void decreaseKey(T item, priority_t priority)
+    {
+        if (!this->contains(item))
+        {
+            throw std::out_of_range("Out of range exception: Cannot decrease key. Item is not in the indexed heap.");
+        }
+
+        size_t slot = this->slots[item];
+
+        if (!(priority < this->nodes[slot].priority))
+        {
+            return;
+        }
+
+        this->counters.decrease_keys++;
+        this->nodes[slot].priority = priority;
+        this->siftUp(slot);
+    }
+
+    /**
+     * @brief Remove all items, keeping allocated memory for reuse
+     *
+     */
+    void clear()
+    {
+        for (const Node &node : this->nodes)
+        {
+            this->slots[node.item] = NONE;
+        }
+
+        this->nodes.clear();
+    }
+
+    /**
+     * @brief Gets `item` with the lowest priority
+     *
+     * @return T
+     */
+    T pop()
+    {
+        if (this->empty())
+        {
+            throw std::out_of_range("Out of range exception: Cannot pop from indexed heap. Indexed heap is empty.");
+        }
+
+        T best_item = this->nodes.front().item;
+
+        this->slots[best_item] = NONE;
+        this->counters.pops++;
+
+        Node last = this->nodes.back();
+        this->nodes.pop_back();
+
+        if (!this->nodes.empty())
+        {
+            this->nodes.front() = last;
+            this->siftDown(0);
+        }
+
+        return best_item;
+    }
+};
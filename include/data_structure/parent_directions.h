@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * Direction from every location of a grid to its parent, packed into 2 bits
+ * per location, 32 locations per word. Direction is an index into
+ * `Graph::directions`, so a parent takes 16 times less memory than a 32-bit
+ * index and a path is read back by stepping along the directions.
+ *
+ * Store does not know which locations were visited; the search that fills it
+ * keeps that, and stale directions of locations it did not reach are never
+ * read, so starting a new search needs no clearing. Locations that share a
+ * word must be set by the same thread
+ *
+ * @tparam Graph - grid with 4 `directions`
+ */
+template <typename Graph> class ParentDirections
+{
+  private:
+    std::vector<uint64_t> words;
+
+  public:
+    /** Locations whose directions share a word */
+    static const size_t WORD_LOCATIONS = 32;
+
+    /**
+     * @brief Construct a new Parent Directions object for a graph with `size`
+     * locations
+     *
+     * @param size
+     */
+    explicit ParentDirections(const size_t size) : words((size + WORD_LOCATIONS - 1) / WORD_LOCATIONS, 0)
+    {
+    }
+
+    /**
+     * @brief Prepare store for a graph with `size` locations, keeping
+     * allocated memory for reuse
+     *
+     * @param size
+     */
+    void reset(const size_t size)
+    {
+        this->words.resize((size + ParentDirections::WORD_LOCATIONS - 1) / ParentDirections::WORD_LOCATIONS, 0);
+    }
+
+    /**
+     * @brief Get amount of words, each holds directions of `WORD_LOCATIONS`
+     * locations
+     *
+     * @return size_t
+     */
+    inline size_t size() const
+    {
+        return this->words.size();
+    }
+
+    /**
+     * @brief Get index in `Graph::directions` of the step from location with
+     * `index` to its parent
+     *
+     * @param index
+     * @return size_t
+     */
+    inline size_t direction(const typename Graph::index_t index) const
+    {
+        return (this->words[index / ParentDirections::WORD_LOCATIONS]
+                >> (index % ParentDirections::WORD_LOCATIONS * 2))
+               & 3;
+    }
+
+    /**
+     * @brief Save the step from location with `index` to its parent
+     *
+     * @param index
+     * @param direction - index in `Graph::directions`
+     */
+    inline void set(const typename Graph::index_t index, const size_t direction)
+    {
+        uint64_t &word  = this->words[index / ParentDirections::WORD_LOCATIONS];
+        size_t    shift = index % ParentDirections::WORD_LOCATIONS * 2;
+
+        word = (word & ~(uint64_t(3) << shift)) | (uint64_t(direction) << shift);
+    }
+};
@@ -1,14 +1,17 @@
 #pragma once
 
-#include <queue>
+#include <algorithm>
+#include <functional>
 #include <stdexcept>
+#include <vector>
 
 template <typename T, typename priority_t> class PriorityQueue
 {
   private:
     typedef std::pair<priority_t, T> PQElement;
 
-    std::priority_queue<PQElement, std::vector<PQElement>, std::greater<PQElement>> elements;
+    // binary min heap, kept in a plain vector so `clear` keeps its capacity
+    std::vector<PQElement> elements;
 
   public:
     /**
@@ -30,7 +33,32 @@ template <typename T, typename priority_t> class PriorityQueue
      */
     inline void push(T item, priority_t priority)
     {
-        this->elements.emplace(priority, item);
+        this->elements.emplace_back(priority, item);
+        std::push_heap(this->elements.begin(), this->elements.end(), std::greater<PQElement>());
+    }
+
+    /**
+     * @brief Remove all items, keeping allocated memory for reuse
+     *
+     */
+    inline void clear()
+    {
+        this->elements.clear();
+    }
+
+    /**
+     * @brief Get the lowest priority in the queue
+     *
+     * @return const priority_t&
+     */
+    const priority_t &topPriority() const
+    {
+        if (this->empty())
+        {
+            throw std::out_of_range("Out of range exception: Cannot get top priority. Priority queue is empty.");
+        }
+
+        return this->elements.front().first;
     }
 
     /**
@@ -45,8 +73,10 @@ template <typename T, typename priority_t> class PriorityQueue
             throw std::out_of_range("Out of range exception: Cannot pop from priority queue. Priority queue is empty.");
         }
 
-        T best_item = this->elements.top().second;
-        elements.pop();
+        std::pop_heap(this->elements.begin(), this->elements.end(), std::greater<PQElement>());
+
+        T best_item = this->elements.back().second;
+        this->elements.pop_back();
         return best_item;
     }
 };
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "data_structure/dense_search_state.h"
+
+/**
+ * Memory a single search needs: ways to every location and the frontier.
+ * Reusing one workspace for many searches on the same graph saves allocating
+ * it every time, and a new search starts in constant time
+ *
+ * @tparam Graph
+ * @tparam Frontier - queue of location indices ordered by cost, one of
+ * `PriorityQueue`, `BucketQueue` or `IndexedHeap`
+ */
+template <typename Graph, typename Frontier> class SearchWorkspace
+{
+  public:
+    DenseSearchState<Graph> state;
+    Frontier                frontier;
+
+    /**
+     * @brief Construct a new Search Workspace object for a graph with `size`
+     * locations
+     *
+     * @param size
+     */
+    explicit SearchWorkspace(const size_t size) : state(size)
+    {
+    }
+
+    /**
+     * @brief Get workspace of the calling thread. It lives as long as the
+     * thread and keeps the memory of the biggest graph searched with it, so
+     * it must not be used by two searches running at once on that thread
+     *
+     * @return SearchWorkspace&
+     */
+    static SearchWorkspace &local()
+    {
+        thread_local SearchWorkspace workspace(0); // sized by the first search
+        return workspace;
+    }
+
+    /**
+     * @brief Prepare workspace for a new search on a graph with `size`
+     * locations
+     *
+     * @param size
+     */
+    void reset(const size_t size)
+    {
+        this->state.reset(size);
+        this->frontier.clear();
+    }
+};
@@ -93,6 +93,18 @@ class GridRenderer : Renderer
         const std::vector<std::vector<Grid::Location>>     &path
     );
 
+    /**
+     * @brief Draw `distances` of every location as a heatmap over the grid of
+     * window with `title`. Locations with `unreachable` distance are not drawn
+     *
+     * @param title
+     * @param distances - distances by location index
+     * @param unreachable - distance of a location that was not reached
+     */
+    void drawHeatmap(
+        const std::string &title, const std::vector<Grid::cost_t> &distances, const Grid::cost_t unreachable
+    );
+
   private:
     std::vector<GridWindow> windows;
 
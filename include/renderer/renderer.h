@@ -23,6 +23,11 @@ class Renderer
         PATHFINDER_CURRENT,
         PATHFINDER_TRAVERSED,
         PATHFINDER_FINAL_TRAVERSED,
+        HEATMAP_NEAREST,
+        HEATMAP_NEAR,
+        HEATMAP_MIDDLE,
+        HEATMAP_FAR,
+        HEATMAP_FARTHEST,
     };
 
     struct ColorPair
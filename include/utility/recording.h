@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstddef>
+
+/**
+ * Recording policies decide at compile time which steps of an algorithm are
+ * saved into its `Grid::ChangeRecord` list. Saving a step reads the clock and
+ * grows a vector, which on big grids costs more than the step itself, so
+ * measured runs save fewer steps or none.
+ *
+ * Algorithm calls `take` once per step and saves the step only if it returns
+ * true. Policy object lives for one run of the algorithm
+ */
+
+/** Saves every step, needed to draw the algorithm */
+struct FullRecording
+{
+    static constexpr bool is_enabled = true;
+
+    /**
+     * @brief Check if the current step is saved
+     *
+     * @return true
+     */
+    constexpr bool take() const
+    {
+        return true;
+    }
+};
+
+/**
+ * Saves every `interval`th step, starting with the first one
+ *
+ * @tparam interval
+ */
+template <size_t interval = 64> struct SampledRecording
+{
+    static_assert(interval > 0, "Interval of sampled recording must be greater than 0");
+
+    static constexpr bool is_enabled = true;
+
+    size_t step = 0;
+
+    /**
+     * @brief Check if the current step is saved and move to the next one
+     *
+     * @return true
+     * @return false
+     */
+    inline bool take()
+    {
+        return this->step++ % interval == 0;
+    }
+};
+
+/** Saves nothing, the record stays empty */
+struct NoRecording
+{
+    static constexpr bool is_enabled = false;
+
+    /**
+     * @brief Check if the current step is saved
+     *
+     * @return false
+     */
+    constexpr bool take() const
+    {
+        return false;
+    }
+};
@@ -28,6 +28,20 @@ class Terminal
         PARALLEL,
         DIJKSTRA_ALGORITHM,
         A_STAR_ALGORITHM,
+        ALT_ALGORITHM,
+        ANYTIME_A_STAR_ALGORITHM,
+        IDA_STAR_ALGORITHM,
+        FRINGE_SEARCH_ALGORITHM,
+        BIDIRECTIONAL_DIJKSTRA_ALGORITHM,
+        BIDIRECTIONAL_A_STAR_ALGORITHM,
+        JUMP_POINT_SEARCH_ALGORITHM,
+        BREADTH_FIRST_SEARCH_ALGORITHM,
+        GREEDY_BEST_FIRST_ALGORITHM,
+        DEPTH_FIRST_SEARCH_ALGORITHM,
+        DELTA_STEPPING_ALGORITHM,
+        HIERARCHICAL_ALGORITHM,
+        D_STAR_LITE_ALGORITHM,
+        FLOW_FIELD_ALGORITHM,
         DEPTH_FIRST_SEARCH_MAZE_GENERATOR,
         BLOCK_MAZE_GENERATOR
     };
@@ -40,8 +54,9 @@ class Terminal
      *
      * @param argc
      * @param argv
+     * @param help_options - options to print if help option is present
      */
-    Terminal(int argc, char **argv);
+    Terminal(int argc, char **argv, const std::vector<Terminal::Option> &help_options = Terminal::options);
 
     /**
      * @brief Print help for the list of commands and exit
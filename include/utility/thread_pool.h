@@ -0,0 +1,90 @@
+#pragma once
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class ThreadPool
+{
+  public:
+    /**
+     * @brief Construct a new Thread Pool object with `threads` workers. The
+     * calling thread is one of the workers
+     *
+     * @param threads - amount of workers, amount of cores if 0
+     */
+    explicit ThreadPool(size_t threads = 0);
+
+    /**
+     * @brief Destroy the Thread Pool object and join workers
+     *
+     */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool &)            = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    /**
+     * @brief Get pool with a worker per core, shared by every pathfinder of
+     * the process that was not given a pool
+     *
+     * @return ThreadPool&
+     */
+    static ThreadPool &shared();
+
+    /**
+     * @brief Get amount of workers, including the calling thread
+     *
+     * @return size_t
+     */
+    size_t size() const;
+
+    /**
+     * @brief Run `task` on every worker and wait until all of them finish.
+     * Task gets index of the worker, calling thread is worker 0. If a worker
+     * throws, the first exception is rethrown on the calling thread once
+     * every worker finished. Tasks run by different threads wait for each
+     * other, a task must not run another one on the same pool
+     *
+     * @param task
+     */
+    void run(const std::function<void(size_t)> &task);
+
+  private:
+    std::vector<std::thread> threads;
+
+    /** Held by the thread whose task runs */
+    std::mutex run_mutex;
+
+    std::mutex              mutex;
+    std::condition_variable task_condition;
+    std::condition_variable done_condition;
+
+    const std::function<void(size_t)> *task = nullptr;
+
+    size_t generation = 0;
+    size_t remaining  = 0;
+    bool   is_stopped = false;
+
+    /** First exception thrown by a worker of the current task */
+    std::exception_ptr error;
+
+    /**
+     * @brief Wait for tasks and run them as worker `worker`
+     *
+     * @param worker
+     */
+    void work(const size_t worker);
+
+    /**
+     * @brief Run `task` as worker `worker` and keep the exception it throws
+     * for the calling thread
+     *
+     * @param task
+     * @param worker
+     */
+    void attempt(const std::function<void(size_t)> &task, const size_t worker);
+};
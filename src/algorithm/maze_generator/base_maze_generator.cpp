@@ -27,6 +27,11 @@ void BaseMazeGenerator::validateArguments(const Grid &grid, const Grid::Location
 
 std::mt19937 BaseMazeGenerator::getRandomGenerator()
 {
+    if (this->seed.has_value())
+    {
+        return std::mt19937(this->seed.value());
+    }
+
     std::random_device        rd;
     std::mt19937::result_type seed
         = rd()
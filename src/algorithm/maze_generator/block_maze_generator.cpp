@@ -6,9 +6,11 @@
 #include <string>
 
 #include "data_structure/grid.h"
+#include "utility/recording.h"
 #include "utility/timer.h"
 
-void BlockMazeGenerator::generate(
+template <typename Recording>
+void BlockMazeGenerator<Recording>::generate(
     Grid &grid, const Grid::Location &start, const Grid::Location &goal, std::vector<Grid::ChangeRecord> &record
 )
 {
@@ -16,13 +18,11 @@ void BlockMazeGenerator::generate(
     record.clear();
 
     Timer        timer;
+    Recording    recording;
     std::mt19937 gen  = this->getRandomGenerator();
     unsigned     step = 0;
 
-    for (size_t i = 0; i < grid.height; i++)
-    {
-        std::fill(grid.grid[i].begin(), grid.grid[i].end(), Grid::CellType::WALL);
-    }
+    grid.fill(Grid::CellType::WALL);
 
     std::uniform_int_distribution<int> block_space_offset_dist(0, (int)grid.height - 3);
     std::uniform_int_distribution<int> block_space_height_dist(2, 5);
@@ -37,7 +37,7 @@ void BlockMazeGenerator::generate(
     {
         int vertical_line_width = vertical_line_width_dist(gen);
         this->removeWall(
-            grid, {current, 0}, {current + vertical_line_width, (int)grid.height - 1}, record, timer, step
+            grid, {current, 0}, {current + vertical_line_width, (int)grid.height - 1}, record, timer, recording, step
         );
 
         current += vertical_line_width + 1;
@@ -65,11 +65,11 @@ void BlockMazeGenerator::generate(
             to   = {current + block_space_width, block_space_offset + block_space_height_dist(gen)};
         }
 
-        this->removeWall(grid, from, to, record, timer, step);
+        this->removeWall(grid, from, to, record, timer, recording, step);
 
         if (is_floating_dist(gen))
         {
-            this->removeWall(grid, {from.x, 0}, {to.x, floating_offset(gen)}, record, timer, step);
+            this->removeWall(grid, {from.x, 0}, {to.x, floating_offset(gen)}, record, timer, recording, step);
         }
 
         if (is_floating_dist(gen))
@@ -80,6 +80,7 @@ void BlockMazeGenerator::generate(
                 {to.x, (int)grid.height - 1},
                 record,
                 timer,
+                recording,
                 step
             );
         }
@@ -88,12 +89,14 @@ void BlockMazeGenerator::generate(
     }
 }
 
-void BlockMazeGenerator::removeWall(
+template <typename Recording>
+void BlockMazeGenerator<Recording>::removeWall(
     Grid                                                                 &grid,
     Grid::Location                                                        from,
     Grid::Location                                                        to,
     std::vector<Grid::ChangeRecord>                                      &record,
     Timer<std::chrono::microseconds, std::chrono::high_resolution_clock> &timer,
+    Recording                                                            &recording,
     unsigned                                                             &step
 )
 {
@@ -113,6 +116,12 @@ void BlockMazeGenerator::removeWall(
         {
             grid[{x, y}] = Grid::CellType::EMPTY;
 
+            if (!recording.take())
+            {
+                step++;
+                continue;
+            }
+
             timer.tock();
             record.push_back({
                 {x, y},
@@ -121,3 +130,8 @@ void BlockMazeGenerator::removeWall(
         }
     }
 }
+
+// generator is used only with these policies, so it is compiled here once
+template class BlockMazeGenerator<FullRecording>;
+template class BlockMazeGenerator<SampledRecording<>>;
+template class BlockMazeGenerator<NoRecording>;
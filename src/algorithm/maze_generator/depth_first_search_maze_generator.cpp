@@ -4,9 +4,11 @@
 #include <stack>
 
 #include "data_structure/grid.h"
+#include "utility/recording.h"
 #include "utility/timer.h"
 
-void DepthFirstSearchMazeGenerator::generate(
+template <typename Recording>
+void DepthFirstSearchMazeGenerator<Recording>::generate(
     Grid &grid, const Grid::Location &start, const Grid::Location &goal, std::vector<Grid::ChangeRecord> &record
 )
 {
@@ -14,18 +16,19 @@ void DepthFirstSearchMazeGenerator::generate(
     record.clear();
 
     Timer        timer;
+    Recording    recording;
     std::mt19937 gen = this->getRandomGenerator();
 
-    for (size_t i = 0; i < grid.height; i++)
-    {
-        std::fill(grid.grid[i].begin(), grid.grid[i].end(), Grid::CellType::WALL);
-    }
+    grid.fill(Grid::CellType::WALL);
 
     grid[start] = Grid::CellType::EMPTY;
-    record.push_back({start, std::chrono::microseconds(0)});
+    grid[goal]  = Grid::CellType::EMPTY;
 
-    grid[goal] = Grid::CellType::EMPTY;
-    record.push_back({goal, std::chrono::microseconds(0)});
+    if (Recording::is_enabled)
+    {
+        record.push_back({start, std::chrono::microseconds(0)});
+        record.push_back({goal, std::chrono::microseconds(0)});
+    }
 
     std::stack<Grid::Location> to_visit;
     to_visit.push(start);
@@ -35,7 +38,7 @@ void DepthFirstSearchMazeGenerator::generate(
         Grid::Location current = to_visit.top();
         to_visit.pop();
 
-        std::vector<Grid::Location> neighbors = grid.neighbors(current, 1, false);
+        Grid::NeighborList neighbors = grid.neighbors(current, 1, false);
 
         if (neighbors.empty())
         {
@@ -52,9 +55,19 @@ void DepthFirstSearchMazeGenerator::generate(
         grid[neighbor_link]   = Grid::CellType::EMPTY;
         grid[random_neighbor] = Grid::CellType::EMPTY;
 
+        if (!recording.take())
+        {
+            continue;
+        }
+
         timer.tock();
 
         record.push_back({neighbor_link, timer.duration()});
         record.push_back({random_neighbor, timer.duration()});
     }
 }
+
+// generator is used only with these policies, so it is compiled here once
+template class DepthFirstSearchMazeGenerator<FullRecording>;
+template class DepthFirstSearchMazeGenerator<SampledRecording<>>;
+template class DepthFirstSearchMazeGenerator<NoRecording>;
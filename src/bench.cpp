@@ -0,0 +1,1125 @@
+#include <stdlib.h>
+
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <iomanip>
+#include <iostream>
+#include <optional>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "algorithm/maze_generator/block_maze_generator.h"
+#include "algorithm/maze_generator/depth_first_search_maze_generator.h"
+#include "algorithm/pathfinder/a_star_search.h"
+#include "algorithm/pathfinder/anytime_a_star_search.h"
+#include "algorithm/pathfinder/batch_search.h"
+#include "algorithm/pathfinder/bidirectional_a_star_search.h"
+#include "algorithm/pathfinder/bidirectional_dijkstra_search.h"
+#include "algorithm/pathfinder/breadth_first_search.h"
+#include "algorithm/pathfinder/d_star_lite_search.h"
+#include "algorithm/pathfinder/delta_stepping_search.h"
+#include "algorithm/pathfinder/depth_first_search.h"
+#include "algorithm/pathfinder/dijkstra_search.h"
+#include "algorithm/pathfinder/distance_transform.h"
+#include "algorithm/pathfinder/flow_field.h"
+#include "algorithm/pathfinder/fringe_search.h"
+#include "algorithm/pathfinder/greedy_best_first_search.h"
+#include "algorithm/pathfinder/hierarchical_path_finder.h"
+#include "algorithm/pathfinder/iterative_deepening_a_star_search.h"
+#include "algorithm/pathfinder/jump_point_search.h"
+#include "algorithm/pathfinder/landmarks.h"
+#include "data_structure/bucket_queue.h"
+#include "data_structure/connectivity_index.h"
+#include "data_structure/corridor_graph.h"
+#include "data_structure/grid.h"
+#include "data_structure/indexed_heap.h"
+#include "data_structure/priority_queue.h"
+#include "utility/recording.h"
+#include "utility/terminal.h"
+#include "utility/thread_pool.h"
+#include "utility/timer.h"
+
+/** Indexes of benchmark options in `bench_options` of `main` */
+enum BenchOptions
+{
+    HELP,
+    WIDTH,
+    HEIGHT,
+    SEED,
+    REPETITIONS,
+    FRONTIER,
+    EDITS,
+    CORRIDORS,
+    QUERIES,
+    THREADS,
+    LANDMARKS,
+    RECORD,
+    BUDGET,
+    DISTANCES,
+    COMPONENTS
+};
+
+/**
+ * @brief Generate maze with generator `maze` that saves steps chosen by
+ * `Recording`
+ *
+ * @tparam Recording
+ * @param maze
+ * @param seed
+ * @param grid
+ * @param start
+ * @param goal
+ * @param record
+ */
+template <typename Recording>
+void generateMaze(
+    const Terminal::Options          maze,
+    const unsigned                   seed,
+    Grid                            &grid,
+    const Grid::Location            &start,
+    const Grid::Location            &goal,
+    std::vector<Grid::ChangeRecord> &record
+)
+{
+    switch (maze)
+    {
+    case Terminal::Options::DEPTH_FIRST_SEARCH_MAZE_GENERATOR:
+    {
+        DepthFirstSearchMazeGenerator<Recording> depth_first_search_maze_generator;
+        depth_first_search_maze_generator.seed = seed;
+        depth_first_search_maze_generator.generate(grid, start, goal, record);
+        break;
+    }
+
+    case Terminal::Options::BLOCK_MAZE_GENERATOR:
+    {
+        BlockMazeGenerator<Recording> block_maze_generator;
+        block_maze_generator.seed = seed;
+        block_maze_generator.generate(grid, start, goal, record);
+        break;
+    }
+
+    default:
+        throw std::invalid_argument("Argument exception: Cannot run benchmark. Unknown maze generator.");
+    }
+}
+
+/** `Frontier`, or the binary heap if `Frontier` needs priorities that never decrease */
+template <typename Frontier>
+using NonMonotoneFrontier = typename std::conditional<
+    std::is_same<Frontier, BucketQueue<Grid::index_t, Grid::cost_t>>::value,
+    PriorityQueue<Grid::index_t, Grid::cost_t>,
+    Frontier>::type;
+
+/**
+ * @brief Run pathfinder `algorithm` using `Frontier` as a search frontier
+ *
+ * @tparam Frontier
+ * @tparam Recording - steps saved by pathfinders accepted by
+ * `isRecordingAlgorithm`, other pathfinders save every step
+ * @param algorithm
+ * @param grid
+ * @param start
+ * @param goal
+ * @param record
+ * @param landmarks - landmarks of `grid`, needed by ALT only
+ * @param components - components of `grid`, Dijkstra and A* reject goals
+ * outside the component of `start` if given
+ * @param schedule - weights and budget of anytime A*
+ * @param solutions - every path found by anytime A*, not saved if `nullptr`
+ * @return std::vector<Grid::Location>
+ */
+template <typename Frontier, typename Recording = FullRecording>
+std::vector<Grid::Location> searchPath(
+    const Terminal::Options             algorithm,
+    const Grid                         &grid,
+    const Grid::Location               &start,
+    const Grid::Location               &goal,
+    std::vector<Grid::ChangeRecord>    &record,
+    const Landmarks<Grid>              *landmarks  = nullptr,
+    const ConnectivityIndex            *components = nullptr,
+    const AnytimeSchedule              &schedule   = AnytimeSchedule(),
+    std::vector<AnytimeSolution<Grid>> *solutions  = nullptr
+)
+{
+    switch (algorithm)
+    {
+    case Terminal::Options::DIJKSTRA_ALGORITHM:
+        if (components != nullptr)
+        {
+            return DijkstraSearch<Grid, Frontier, Recording>::search(grid, start, goal, record, *components);
+        }
+
+        return DijkstraSearch<Grid, Frontier, Recording>::search(grid, start, goal, record);
+
+    case Terminal::Options::A_STAR_ALGORITHM:
+        if (components != nullptr)
+        {
+            return AStarSearch<Grid, Frontier, Recording>::search(
+                grid, start, goal, ManhattanHeuristic<Grid>(), UnitCost<Grid>(), record, *components
+            );
+        }
+
+        return AStarSearch<Grid, Frontier, Recording>::search(
+            grid, start, goal, ManhattanHeuristic<Grid>(), UnitCost<Grid>(), record
+        );
+
+    case Terminal::Options::ALT_ALGORITHM:
+        if (landmarks == nullptr)
+        {
+            throw std::invalid_argument("Argument exception: Cannot run benchmark. ALT needs landmarks.");
+        }
+
+        return AStarSearch<Grid, Frontier, Recording>::search(
+            grid, start, goal, *landmarks, UnitCost<Grid>(), record
+        );
+
+    case Terminal::Options::ANYTIME_A_STAR_ALGORITHM: {
+        std::vector<AnytimeSolution<Grid>> found
+            = AnytimeAStarSearch<Grid, NonMonotoneFrontier<Frontier>, Recording>::search(
+                grid, start, goal, ManhattanHeuristic<Grid>(), UnitCost<Grid>(), schedule, &record
+            );
+
+        std::vector<Grid::Location> path = found.empty() ? std::vector<Grid::Location>() : found.back().path;
+
+        if (solutions != nullptr)
+        {
+            *solutions = std::move(found);
+        }
+
+        return path;
+    }
+
+    case Terminal::Options::IDA_STAR_ALGORITHM:
+        // keeps only the current way, `Frontier` is not used
+        return IterativeDeepeningAStarSearch<Grid, Recording>::search(
+            grid, start, goal, ManhattanHeuristic<Grid>(), UnitCost<Grid>(), &record
+        );
+
+    case Terminal::Options::FRINGE_SEARCH_ALGORITHM:
+        // fringe is a linked list, `Frontier` is not used
+        return FringeSearch<Grid, Recording>::search(
+            grid, start, goal, ManhattanHeuristic<Grid>(), UnitCost<Grid>(), &record
+        );
+
+    case Terminal::Options::BIDIRECTIONAL_DIJKSTRA_ALGORITHM:
+        return BidirectionalDijkstraSearch<Grid, Frontier>::search(grid, start, goal, record);
+
+    case Terminal::Options::BIDIRECTIONAL_A_STAR_ALGORITHM:
+        return BidirectionalAStarSearch<Grid, Frontier>::search(grid, start, goal, Grid::heuristic, record);
+
+    case Terminal::Options::JUMP_POINT_SEARCH_ALGORITHM:
+        return JumpPointSearch<Grid, Frontier>::search(grid, start, goal, Grid::heuristic, record);
+
+    case Terminal::Options::BREADTH_FIRST_SEARCH_ALGORITHM:
+        // frontier is a bitset, `Frontier` is not used
+        return BreadthFirstSearch<Grid>::search(grid, start, goal, record);
+
+    case Terminal::Options::GREEDY_BEST_FIRST_ALGORITHM:
+        return GreedyBestFirstSearch<Grid, NonMonotoneFrontier<Frontier>, Recording>::search(
+            grid, start, goal, ManhattanHeuristic<Grid>(), record
+        );
+
+    case Terminal::Options::DEPTH_FIRST_SEARCH_ALGORITHM:
+        return DepthFirstSearch<Grid, NonMonotoneFrontier<Frontier>, Recording>::search(grid, start, goal, record);
+
+    case Terminal::Options::DELTA_STEPPING_ALGORITHM:
+        // buckets are vectors, `Frontier` is not used
+        return DeltaSteppingSearch<Grid>::search(grid, start, goal, record);
+
+    case Terminal::Options::D_STAR_LITE_ALGORITHM:
+        // keys are pairs, `Frontier` is not used
+        return DStarLiteSearch<Grid>(grid, start, goal, Grid::heuristic).search(record);
+
+    default:
+        throw std::invalid_argument("Argument exception: Cannot run benchmark. Unknown pathfinder algorithm.");
+    }
+}
+
+/**
+ * @brief Run pathfinder `algorithm` using frontier named `frontier` as a search
+ * frontier
+ *
+ * @tparam Recording - steps saved by Dijkstra, A* and ALT
+ * @param frontier - one of `priority-queue`, `bucket-queue` or `indexed-heap`
+ * @param algorithm
+ * @param grid
+ * @param start
+ * @param goal
+ * @param record
+ * @param landmarks - landmarks of `grid`, needed by ALT only
+ * @param components - components of `grid`, Dijkstra and A* reject goals
+ * outside the component of `start` if given
+ * @param schedule - weights and budget of anytime A*
+ * @param solutions - every path found by anytime A*, not saved if `nullptr`
+ * @return std::vector<Grid::Location>
+ */
+template <typename Recording>
+std::vector<Grid::Location> searchPathWith(
+    const std::string                  &frontier,
+    const Terminal::Options             algorithm,
+    const Grid                         &grid,
+    const Grid::Location               &start,
+    const Grid::Location               &goal,
+    std::vector<Grid::ChangeRecord>    &record,
+    const Landmarks<Grid>              *landmarks  = nullptr,
+    const ConnectivityIndex            *components = nullptr,
+    const AnytimeSchedule              &schedule   = AnytimeSchedule(),
+    std::vector<AnytimeSolution<Grid>> *solutions  = nullptr
+)
+{
+    if (frontier == "bucket-queue")
+    {
+        return searchPath<BucketQueue<Grid::index_t, Grid::cost_t>, Recording>(
+            algorithm, grid, start, goal, record, landmarks, components, schedule, solutions
+        );
+    }
+
+    if (frontier == "indexed-heap")
+    {
+        return searchPath<IndexedHeap<Grid::index_t, Grid::cost_t>, Recording>(
+            algorithm, grid, start, goal, record, landmarks, components, schedule, solutions
+        );
+    }
+
+    return searchPath<PriorityQueue<Grid::index_t, Grid::cost_t>, Recording>(
+        algorithm, grid, start, goal, record, landmarks, components, schedule, solutions
+    );
+}
+
+/**
+ * @brief Check if pathfinder `algorithm` saves steps chosen by a recording
+ * policy
+ *
+ * @param algorithm
+ * @return true
+ * @return false
+ */
+bool isRecordingAlgorithm(const Terminal::Options algorithm)
+{
+    switch (algorithm)
+    {
+    case Terminal::Options::DIJKSTRA_ALGORITHM:
+    case Terminal::Options::A_STAR_ALGORITHM:
+    case Terminal::Options::ALT_ALGORITHM:
+    case Terminal::Options::ANYTIME_A_STAR_ALGORITHM:
+    case Terminal::Options::IDA_STAR_ALGORITHM:
+    case Terminal::Options::FRINGE_SEARCH_ALGORITHM:
+    case Terminal::Options::GREEDY_BEST_FIRST_ALGORITHM:
+    case Terminal::Options::DEPTH_FIRST_SEARCH_ALGORITHM:
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+/**
+ * @brief Get name of the frontier pathfinder `algorithm` runs on when
+ * `frontier` is chosen. Priorities of some pathfinders decrease, so they run
+ * on the binary heap instead of the bucket queue
+ *
+ * @param algorithm
+ * @param frontier
+ * @return std::string
+ */
+std::string usedFrontier(const Terminal::Options algorithm, const std::string &frontier)
+{
+    switch (algorithm)
+    {
+    case Terminal::Options::ANYTIME_A_STAR_ALGORITHM:
+    case Terminal::Options::GREEDY_BEST_FIRST_ALGORITHM:
+    case Terminal::Options::DEPTH_FIRST_SEARCH_ALGORITHM:
+        return frontier == "bucket-queue" ? "priority-queue" : frontier;
+
+    default:
+        return frontier;
+    }
+}
+
+/**
+ * @brief Check if pathfinder `algorithm` can search any graph, not only a grid
+ *
+ * @param algorithm
+ * @return true
+ * @return false
+ */
+bool isGraphAlgorithm(const Terminal::Options algorithm)
+{
+    switch (algorithm)
+    {
+    case Terminal::Options::DIJKSTRA_ALGORITHM:
+    case Terminal::Options::A_STAR_ALGORITHM:
+    case Terminal::Options::BIDIRECTIONAL_DIJKSTRA_ALGORITHM:
+    case Terminal::Options::BIDIRECTIONAL_A_STAR_ALGORITHM:
+    case Terminal::Options::DELTA_STEPPING_ALGORITHM:
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+/**
+ * @brief Run pathfinder `algorithm` on nodes of `corridors` using `Frontier`
+ * as a search frontier and expand the path into cells
+ *
+ * @tparam Frontier
+ * @param algorithm - one of the algorithms accepted by `isGraphAlgorithm`
+ * @param corridors - graph with `start` and `goal` as nodes
+ * @param start
+ * @param goal
+ * @param record
+ * @return std::vector<Grid::Location>
+ */
+template <typename Frontier>
+std::vector<Grid::Location> searchCorridors(
+    const Terminal::Options          algorithm,
+    const CorridorGraph             &corridors,
+    const Grid::Location            &start,
+    const Grid::Location            &goal,
+    std::vector<Grid::ChangeRecord> &record
+)
+{
+    switch (algorithm)
+    {
+    case Terminal::Options::DIJKSTRA_ALGORITHM:
+        return corridors.expand(DijkstraSearch<CorridorGraph, Frontier>::search(corridors, start, goal, record));
+
+    case Terminal::Options::A_STAR_ALGORITHM:
+        return corridors.expand(
+            AStarSearch<CorridorGraph, Frontier>::search(corridors, start, goal, CorridorGraph::heuristic, record)
+        );
+
+    case Terminal::Options::BIDIRECTIONAL_DIJKSTRA_ALGORITHM:
+        return corridors.expand(
+            BidirectionalDijkstraSearch<CorridorGraph, Frontier>::search(corridors, start, goal, record)
+        );
+
+    case Terminal::Options::BIDIRECTIONAL_A_STAR_ALGORITHM:
+        return corridors.expand(BidirectionalAStarSearch<CorridorGraph, Frontier>::search(
+            corridors, start, goal, CorridorGraph::heuristic, record
+        ));
+
+    case Terminal::Options::DELTA_STEPPING_ALGORITHM:
+        return corridors.expand(DeltaSteppingSearch<CorridorGraph>::search(corridors, start, goal, record));
+
+    default:
+        throw std::invalid_argument("Argument exception: Cannot run benchmark. Pathfinder cannot search corridors.");
+    }
+}
+
+/**
+ * @brief Check if pathfinder `algorithm` can solve queries of a batch. Other
+ * pathfinders keep state between queries or run on a thread pool themselves
+ *
+ * @param algorithm
+ * @return true
+ * @return false
+ */
+bool isBatchAlgorithm(const Terminal::Options algorithm)
+{
+    switch (algorithm)
+    {
+    case Terminal::Options::DELTA_STEPPING_ALGORITHM:
+    case Terminal::Options::HIERARCHICAL_ALGORITHM:
+    case Terminal::Options::D_STAR_LITE_ALGORITHM:
+    case Terminal::Options::FLOW_FIELD_ALGORITHM:
+        return false;
+
+    default:
+        return true;
+    }
+}
+
+/**
+ * @brief Solve `queries` in parallel with pathfinder `algorithm` using
+ * `Frontier` as a search frontier
+ *
+ * @tparam Frontier
+ * @param algorithm - one of the algorithms accepted by `isBatchAlgorithm`
+ * @param grid
+ * @param queries
+ * @param pool
+ * @param landmarks - landmarks of `grid`, needed by ALT only
+ * @param components - components of `grid`, Dijkstra and A* reject goals
+ * outside the component of `start` if given
+ * @return std::vector<std::vector<Grid::Location>> - paths in order of
+ * `queries`
+ */
+template <typename Frontier>
+std::vector<std::vector<Grid::Location>> searchBatch(
+    const Terminal::Options             algorithm,
+    const Grid                         &grid,
+    const std::vector<PathQuery<Grid>> &queries,
+    ThreadPool                         &pool,
+    const Landmarks<Grid>              *landmarks  = nullptr,
+    const ConnectivityIndex            *components = nullptr
+)
+{
+    typedef BatchSearch<Grid, Frontier> Batch;
+
+    switch (algorithm)
+    {
+    case Terminal::Options::DIJKSTRA_ALGORITHM:
+        return Batch::search(
+            grid,
+            queries,
+            [components](
+                const Grid                      &graph,
+                const Grid::Location            &start,
+                const Grid::Location            &goal,
+                std::vector<Grid::ChangeRecord> *record,
+                typename Batch::Workspace       &workspace
+            ) {
+                if (components != nullptr)
+                {
+                    return DijkstraSearch<Grid, Frontier>::search(graph, start, goal, record, workspace, *components);
+                }
+
+                return DijkstraSearch<Grid, Frontier>::search(graph, start, goal, record, workspace);
+            },
+            pool
+        );
+
+    case Terminal::Options::A_STAR_ALGORITHM:
+        return Batch::search(
+            grid,
+            queries,
+            [components](
+                const Grid                      &graph,
+                const Grid::Location            &start,
+                const Grid::Location            &goal,
+                std::vector<Grid::ChangeRecord> *record,
+                typename Batch::Workspace       &workspace
+            ) {
+                if (components != nullptr)
+                {
+                    return AStarSearch<Grid, Frontier>::search(
+                        graph, start, goal, ManhattanHeuristic<Grid>(), UnitCost<Grid>(), record, workspace, *components
+                    );
+                }
+
+                return AStarSearch<Grid, Frontier>::search(
+                    graph, start, goal, ManhattanHeuristic<Grid>(), UnitCost<Grid>(), record, workspace
+                );
+            },
+            pool
+        );
+
+    case Terminal::Options::ALT_ALGORITHM:
+        if (landmarks == nullptr)
+        {
+            throw std::invalid_argument("Argument exception: Cannot run benchmark. ALT needs landmarks.");
+        }
+
+        return Batch::search(
+            grid,
+            queries,
+            [landmarks](
+                const Grid                      &graph,
+                const Grid::Location            &start,
+                const Grid::Location            &goal,
+                std::vector<Grid::ChangeRecord> *record,
+                typename Batch::Workspace       &workspace
+            ) {
+                return AStarSearch<Grid, Frontier>::search(
+                    graph, start, goal, *landmarks, UnitCost<Grid>(), record, workspace
+                );
+            },
+            pool
+        );
+
+    default:
+        // pathfinders without a workspace allocate their own memory and always record
+        return Batch::search(
+            grid,
+            queries,
+            [algorithm](
+                const Grid                      &graph,
+                const Grid::Location            &start,
+                const Grid::Location            &goal,
+                std::vector<Grid::ChangeRecord> *record,
+                typename Batch::Workspace &
+            ) {
+                std::vector<Grid::ChangeRecord> steps;
+                std::vector<Grid::Location>     path = searchPath<Frontier>(algorithm, graph, start, goal, steps);
+
+                if (record != nullptr)
+                {
+                    record->swap(steps);
+                }
+
+                return path;
+            },
+            pool
+        );
+    }
+}
+
+/**
+ * @brief Build distance map of a grid from `start` with the vector and the
+ * scalar kernel and print a row for each, with the amount of reached cells
+ *
+ * @tparam distance_t - type of a distance, must fit the longest distance
+ * @param row - maze, run and seed columns of the row
+ * @param grid
+ * @param start
+ */
+template <typename distance_t>
+void benchDistances(const std::string &row, const Grid &grid, const Grid::Location &start)
+{
+    typedef DistanceTransform<Grid, distance_t> Transform;
+
+    for (bool is_vectorized : {true, false})
+    {
+        Timer timer;
+
+        timer.tick();
+        std::vector<distance_t> distances = Transform::distances(grid, start, is_vectorized);
+        timer.tock();
+
+        size_t reached = std::count_if(distances.begin(), distances.end(), [](distance_t distance) {
+            return distance != Transform::UNREACHABLE;
+        });
+
+        std::cout << row << "\tdistance-transform\t" << (is_vectorized ? Transform::vectorKernel() : "scalar") << "\t"
+                  << timer.duration().count() << "\t" << reached << "\t-" << std::endl;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    // help option must be the first one, so `Terminal` can find it
+    const std::vector<Terminal::Option> bench_options = {
+        Terminal::options[Terminal::Options::HELP],
+        {"",  "width",       true,  "", "1023",           "Set grid width"                                            },
+        {"",  "height",      true,  "", "1023",           "Set grid height"                                           },
+        {"s", "seed",        true,  "", "0",              "Set seed of the first run, each next run increments it"    },
+        {"r", "repetitions", true,  "", "5",              "Set amount of runs for each maze generator"                },
+        {"f", "frontier",    true,  "", "priority-queue", "Set frontier (priority-queue, bucket-queue, indexed-heap)"},
+        {"e", "edits",       true,  "", "0",              "Set amount of path cells to block before D* Lite replans"  },
+        {"c", "corridors",   false, "", "",               "Search graph of contracted corridors where possible"       },
+        {"q", "queries",     true,  "", "0",              "Set amount of random queries to solve as a batch"          },
+        {"t", "threads",     true,  "", "0",              "Set amount of threads to solve batch on, 0 for every core" },
+        {"k", "landmarks",   true,  "", "8",              "Set amount of landmarks for ALT"                           },
+        {"R", "record",      true,  "", "full",           "Set steps to record (full, sampled, none)"                 },
+        {"b", "budget",      true,  "", "0",              "Set anytime A* time budget (microseconds), 0 for none"     },
+        {"d", "distances",   false, "", "",               "Build distance map from start with every kernel"           },
+        {"",  "components",  false, "", "",               "Reject unreachable Dijkstra and A* goals by component"     },
+        Terminal::options[Terminal::Options::DIJKSTRA_ALGORITHM],
+        Terminal::options[Terminal::Options::A_STAR_ALGORITHM],
+        Terminal::options[Terminal::Options::ALT_ALGORITHM],
+        Terminal::options[Terminal::Options::ANYTIME_A_STAR_ALGORITHM],
+        Terminal::options[Terminal::Options::IDA_STAR_ALGORITHM],
+        Terminal::options[Terminal::Options::FRINGE_SEARCH_ALGORITHM],
+        Terminal::options[Terminal::Options::BIDIRECTIONAL_DIJKSTRA_ALGORITHM],
+        Terminal::options[Terminal::Options::BIDIRECTIONAL_A_STAR_ALGORITHM],
+        Terminal::options[Terminal::Options::JUMP_POINT_SEARCH_ALGORITHM],
+        Terminal::options[Terminal::Options::BREADTH_FIRST_SEARCH_ALGORITHM],
+        Terminal::options[Terminal::Options::GREEDY_BEST_FIRST_ALGORITHM],
+        Terminal::options[Terminal::Options::DEPTH_FIRST_SEARCH_ALGORITHM],
+        Terminal::options[Terminal::Options::DELTA_STEPPING_ALGORITHM],
+        Terminal::options[Terminal::Options::HIERARCHICAL_ALGORITHM],
+        Terminal::options[Terminal::Options::D_STAR_LITE_ALGORITHM],
+        Terminal::options[Terminal::Options::FLOW_FIELD_ALGORITHM],
+        Terminal::options[Terminal::Options::DEPTH_FIRST_SEARCH_MAZE_GENERATOR],
+        Terminal::options[Terminal::Options::BLOCK_MAZE_GENERATOR]
+    };
+
+    Terminal terminal(argc, argv, bench_options);
+
+    // global catch to edit exception error output
+    try
+    {
+        // arguments
+        size_t   width       = terminal.getOptionValue<size_t>(bench_options[BenchOptions::WIDTH], 1023);
+        size_t   height      = terminal.getOptionValue<size_t>(bench_options[BenchOptions::HEIGHT], 1023);
+        unsigned seed        = terminal.getOptionValue<unsigned>(bench_options[BenchOptions::SEED], 0);
+        unsigned repetitions = terminal.getOptionValue<unsigned>(bench_options[BenchOptions::REPETITIONS], 5);
+        std::string frontier
+            = terminal.getOptionValue<std::string>(bench_options[BenchOptions::FRONTIER], "priority-queue");
+        unsigned edits        = terminal.getOptionValue<unsigned>(bench_options[BenchOptions::EDITS], 0);
+        bool     is_corridors = terminal.isOptionExists(bench_options[BenchOptions::CORRIDORS]);
+        size_t   queries      = terminal.getOptionValue<size_t>(bench_options[BenchOptions::QUERIES], 0);
+        size_t   threads      = terminal.getOptionValue<size_t>(bench_options[BenchOptions::THREADS], 0);
+        size_t   landmarks_k  = terminal.getOptionValue<size_t>(bench_options[BenchOptions::LANDMARKS], 8);
+        std::string record_mode  = terminal.getOptionValue<std::string>(bench_options[BenchOptions::RECORD], "full");
+        unsigned    budget       = terminal.getOptionValue<unsigned>(bench_options[BenchOptions::BUDGET], 0);
+        bool        is_distances  = terminal.isOptionExists(bench_options[BenchOptions::DISTANCES]);
+        bool        is_components = terminal.isOptionExists(bench_options[BenchOptions::COMPONENTS]);
+
+        if (frontier != "priority-queue" && frontier != "bucket-queue" && frontier != "indexed-heap")
+        {
+            throw std::invalid_argument(
+                "Argument exception: Cannot run benchmark. Unknown frontier '" + frontier + "'."
+            );
+        }
+
+        if (record_mode != "full" && record_mode != "sampled" && record_mode != "none")
+        {
+            throw std::invalid_argument(
+                "Argument exception: Cannot run benchmark. Unknown record mode '" + record_mode + "'."
+            );
+        }
+
+        AnytimeSchedule schedule;
+
+        if (budget > 0)
+        {
+            schedule.time = std::chrono::microseconds(budget);
+        }
+
+        auto addArgument = [terminal](std::vector<Terminal::Options> &vec, Terminal::Options opt) {
+            if (terminal.isOptionExists(terminal.options[opt]))
+            {
+                vec.push_back(opt);
+            }
+        };
+
+        std::vector<Terminal::Options> algorithms;
+
+        addArgument(algorithms, Terminal::Options::DIJKSTRA_ALGORITHM);
+        addArgument(algorithms, Terminal::Options::A_STAR_ALGORITHM);
+        addArgument(algorithms, Terminal::Options::ALT_ALGORITHM);
+        addArgument(algorithms, Terminal::Options::ANYTIME_A_STAR_ALGORITHM);
+        addArgument(algorithms, Terminal::Options::IDA_STAR_ALGORITHM);
+        addArgument(algorithms, Terminal::Options::FRINGE_SEARCH_ALGORITHM);
+        addArgument(algorithms, Terminal::Options::BIDIRECTIONAL_DIJKSTRA_ALGORITHM);
+        addArgument(algorithms, Terminal::Options::BIDIRECTIONAL_A_STAR_ALGORITHM);
+        addArgument(algorithms, Terminal::Options::JUMP_POINT_SEARCH_ALGORITHM);
+        addArgument(algorithms, Terminal::Options::BREADTH_FIRST_SEARCH_ALGORITHM);
+        addArgument(algorithms, Terminal::Options::GREEDY_BEST_FIRST_ALGORITHM);
+        addArgument(algorithms, Terminal::Options::DEPTH_FIRST_SEARCH_ALGORITHM);
+        addArgument(algorithms, Terminal::Options::DELTA_STEPPING_ALGORITHM);
+        addArgument(algorithms, Terminal::Options::HIERARCHICAL_ALGORITHM);
+        addArgument(algorithms, Terminal::Options::D_STAR_LITE_ALGORITHM);
+        addArgument(algorithms, Terminal::Options::FLOW_FIELD_ALGORITHM);
+
+        if (algorithms.empty())
+        {
+            throw std::invalid_argument(
+                "Argument exception: Cannot start a program. Must include at least one algorithm."
+            );
+        }
+
+        std::vector<Terminal::Options> maze_generators;
+
+        addArgument(maze_generators, Terminal::Options::DEPTH_FIRST_SEARCH_MAZE_GENERATOR);
+        addArgument(maze_generators, Terminal::Options::BLOCK_MAZE_GENERATOR);
+
+        if (maze_generators.empty())
+        {
+            throw std::invalid_argument(
+                "Argument exception: Cannot start a program. Must include at least one maze generator."
+            );
+        }
+
+        // maze generators need odd dimensions, same as grid of `GridRenderer`
+        Grid grid(width % 2 == 0 ? width - 1 : width, height % 2 == 0 ? height - 1 : height);
+
+        int start_x = grid.width / 2;
+        int start_y = grid.height / 2;
+
+        Grid::Location start{start_x % 2 == 0 ? ++start_x : start_x, start_y % 2 == 0 ? ++start_y : start_y};
+        Grid::Location end{(int)grid.width - 1, (int)grid.height - 2};
+
+        std::optional<ThreadPool> pool;
+
+        if (queries > 0)
+        {
+            pool.emplace(threads);
+        }
+
+        std::cout << "maze\trun\tseed\talgorithm\tfrontier\ttime_us\texpanded\tpath_length" << std::endl;
+
+        for (Terminal::Options maze_option : maze_generators)
+        {
+            for (unsigned run = 0; run < repetitions; run++)
+            {
+                std::vector<Grid::ChangeRecord> maze_record;
+
+                Timer timer;
+
+                if (record_mode == "none")
+                {
+                    generateMaze<NoRecording>(maze_option, seed + run, grid, start, end, maze_record);
+                }
+                else if (record_mode == "sampled")
+                {
+                    generateMaze<SampledRecording<>>(maze_option, seed + run, grid, start, end, maze_record);
+                }
+                else
+                {
+                    generateMaze<FullRecording>(maze_option, seed + run, grid, start, end, maze_record);
+                }
+
+                timer.tock();
+
+                std::string maze_name = terminal.options[maze_option].long_cmd;
+
+                // steps are counted only when every one of them is saved
+                std::string maze_steps = record_mode == "full" ? std::to_string(maze_record.size()) : "-";
+
+                std::cout << maze_name << "\t" << run << "\t" << seed + run << "\tgeneration\t-\t"
+                          << timer.duration().count() << "\t" << maze_steps << "\t-" << std::endl;
+
+                // abstract graph is built once per maze, so the search row measures a query only
+                std::optional<HierarchicalPathFinder<Grid>> hierarchical;
+
+                if (std::find(algorithms.begin(), algorithms.end(), Terminal::Options::HIERARCHICAL_ALGORITHM)
+                    != algorithms.end())
+                {
+                    timer.tick();
+                    hierarchical.emplace(grid);
+                    timer.tock();
+
+                    std::cout << maze_name << "\t" << run << "\t" << seed + run << "\thierarchical-build\t-\t"
+                              << timer.duration().count() << "\t" << hierarchical->size() << "\t-" << std::endl;
+                }
+
+                // landmark costs are found once per maze, same as the abstract graph
+                std::optional<Landmarks<Grid>> landmarks;
+
+                if (std::find(algorithms.begin(), algorithms.end(), Terminal::Options::ALT_ALGORITHM)
+                    != algorithms.end())
+                {
+                    timer.tick();
+                    landmarks.emplace(grid, landmarks_k);
+                    timer.tock();
+
+                    std::cout << maze_name << "\t" << run << "\t" << seed + run << "\talt-build\t-\t"
+                              << timer.duration().count() << "\t" << landmarks->size() << "\t-" << std::endl;
+                }
+
+                const Landmarks<Grid> *alt_landmarks = landmarks.has_value() ? &landmarks.value() : nullptr;
+
+                // corridor graph is built once per maze, same as the abstract graph
+                std::optional<CorridorGraph> corridors;
+
+                if (is_corridors)
+                {
+                    timer.tick();
+                    corridors.emplace(grid, std::vector<Grid::Location>{start, end});
+                    timer.tock();
+
+                    std::cout << maze_name << "\t" << run << "\t" << seed + run << "\tcorridor-build\t-\t"
+                              << timer.duration().count() << "\t" << corridors->size() << "\t-" << std::endl;
+                }
+
+                // components are found once per maze and updated when cells change
+                std::optional<ConnectivityIndex> components;
+
+                if (is_components)
+                {
+                    timer.tick();
+                    components.emplace(grid);
+                    timer.tock();
+
+                    // size of the largest component goes to the last column
+                    std::vector<size_t> component_sizes = components->componentSizes();
+
+                    std::cout << maze_name << "\t" << run << "\t" << seed + run << "\tcomponents-build\t-\t"
+                              << timer.duration().count() << "\t" << components->size() << "\t"
+                              << (component_sizes.empty() ? 0 : component_sizes.front()) << std::endl;
+                }
+
+                const ConnectivityIndex *search_components = components.has_value() ? &components.value() : nullptr;
+
+                // distance map does not depend on the goal, so it is built once per maze
+                if (is_distances)
+                {
+                    std::string row = maze_name + "\t" + std::to_string(run) + "\t" + std::to_string(seed + run);
+
+                    // no distance is longer than the amount of cells
+                    if (grid.size() < DistanceTransform<Grid>::UNREACHABLE)
+                    {
+                        benchDistances<uint16_t>(row, grid, start);
+                    }
+                    else
+                    {
+                        benchDistances<uint32_t>(row, grid, start);
+                    }
+                }
+
+                for (Terminal::Options algorithm_option : algorithms)
+                {
+                    std::vector<Grid::ChangeRecord>      traversed;
+                    std::vector<Grid::Location>          path;
+                    std::string                          algorithm_name = terminal.options[algorithm_option].long_cmd;
+                    std::string                          algorithm_frontier = usedFrontier(algorithm_option, frontier);
+                    std::optional<DStarLiteSearch<Grid>> planner;
+                    std::optional<FlowField<Grid>>       field;
+                    std::vector<AnytimeSolution<Grid>>   solutions;
+
+                    bool is_corridor_search = corridors.has_value() && isGraphAlgorithm(algorithm_option);
+
+                    timer.tick();
+
+                    if (is_corridor_search)
+                    {
+                        algorithm_name += "-corridors";
+
+                        if (frontier == "bucket-queue")
+                        {
+                            path = searchCorridors<BucketQueue<Grid::index_t, Grid::cost_t>>(
+                                algorithm_option, corridors.value(), start, end, traversed
+                            );
+                        }
+                        else if (frontier == "indexed-heap")
+                        {
+                            path = searchCorridors<IndexedHeap<Grid::index_t, Grid::cost_t>>(
+                                algorithm_option, corridors.value(), start, end, traversed
+                            );
+                        }
+                        else
+                        {
+                            path = searchCorridors<PriorityQueue<Grid::index_t, Grid::cost_t>>(
+                                algorithm_option, corridors.value(), start, end, traversed
+                            );
+                        }
+                    }
+                    else if (algorithm_option == Terminal::Options::HIERARCHICAL_ALGORITHM)
+                    {
+                        path               = hierarchical->search(start, end, traversed);
+                        algorithm_frontier = "priority-queue";
+                    }
+                    else if (algorithm_option == Terminal::Options::D_STAR_LITE_ALGORITHM)
+                    {
+                        planner.emplace(grid, start, end, Grid::heuristic);
+                        path               = planner->search(traversed);
+                        algorithm_frontier = "priority-queue";
+                    }
+                    else if (algorithm_option == Terminal::Options::FLOW_FIELD_ALGORITHM)
+                    {
+                        field.emplace(grid, end);
+                        path               = field->path(start);
+                        algorithm_frontier = "-";
+                    }
+                    else if (record_mode == "none")
+                    {
+                        path = searchPathWith<NoRecording>(
+                            frontier,
+                            algorithm_option,
+                            grid,
+                            start,
+                            end,
+                            traversed,
+                            alt_landmarks,
+                            search_components,
+                            schedule,
+                            &solutions
+                        );
+                    }
+                    else if (record_mode == "sampled")
+                    {
+                        path = searchPathWith<SampledRecording<>>(
+                            frontier,
+                            algorithm_option,
+                            grid,
+                            start,
+                            end,
+                            traversed,
+                            alt_landmarks,
+                            search_components,
+                            schedule,
+                            &solutions
+                        );
+                    }
+                    else
+                    {
+                        path = searchPathWith<FullRecording>(
+                            frontier,
+                            algorithm_option,
+                            grid,
+                            start,
+                            end,
+                            traversed,
+                            alt_landmarks,
+                            search_components,
+                            schedule,
+                            &solutions
+                        );
+                    }
+
+                    timer.tock();
+
+                    std::string expanded = std::to_string(traversed.size());
+
+                    if (record_mode != "full" && isRecordingAlgorithm(algorithm_option) && !is_corridor_search)
+                    {
+                        // record holds only some of the expanded locations
+                        expanded = "-";
+                    }
+
+                    if (field.has_value())
+                    {
+                        // field settles every location that reaches the goal
+                        std::vector<Grid::cost_t> distances = field->distances();
+
+                        expanded = std::to_string(std::count_if(
+                            distances.begin(),
+                            distances.end(),
+                            [](Grid::cost_t distance) { return distance != FlowField<Grid>::UNREACHABLE; }
+                        ));
+                    }
+
+                    std::cout << maze_name << "\t" << run << "\t" << seed + run << "\t" << algorithm_name << "\t"
+                              << algorithm_frontier << "\t" << timer.duration().count() << "\t" << expanded << "\t"
+                              << path.size() << std::endl;
+
+                    for (const AnytimeSolution<Grid> &solution : solutions)
+                    {
+                        // each improved path, named by its suboptimality bound
+                        std::ostringstream solution_name;
+                        solution_name << algorithm_name << "@" << std::fixed << std::setprecision(2) << solution.bound;
+
+                        std::cout << maze_name << "\t" << run << "\t" << seed + run << "\t" << solution_name.str()
+                                  << "\t" << algorithm_frontier << "\t" << solution.time.count() << "\t"
+                                  << solution.expanded << "\t" << solution.path.size() << std::endl;
+                    }
+
+                    if (field.has_value())
+                    {
+                        // every next agent only reads its path
+                        timer.tick();
+                        path = field->path(start);
+                        timer.tock();
+
+                        std::cout << maze_name << "\t" << run << "\t" << seed + run << "\tflow-field-query\t-\t"
+                                  << timer.duration().count() << "\t0\t" << path.size() << std::endl;
+                    }
+
+                    if (!planner.has_value() || edits == 0 || path.size() <= 2)
+                    {
+                        continue;
+                    }
+
+                    // block random cells of the path and let D* Lite repair it
+                    std::mt19937                          gen(seed + run);
+                    std::uniform_int_distribution<size_t> path_cell_dist(1, path.size() - 2);
+                    std::vector<Grid::CellChange>         changes;
+
+                    for (unsigned edit = 0; edit < edits; edit++)
+                    {
+                        changes.push_back({path[path_cell_dist(gen)], Grid::CellType::WALL});
+                    }
+
+                    std::vector<Grid::Location>     changed = grid.apply(changes);
+                    std::vector<Grid::ChangeRecord> replan_record;
+
+                    if (components.has_value())
+                    {
+                        components->update(changed);
+                    }
+
+                    timer.tick();
+                    planner->update(changed);
+                    path = planner->search(replan_record);
+                    timer.tock();
+
+                    std::cout << maze_name << "\t" << run << "\t" << seed + run << "\td-star-lite-replan\t"
+                              << algorithm_frontier << "\t" << timer.duration().count() << "\t"
+                              << replan_record.size() << "\t" << path.size() << std::endl;
+
+                    // restore the maze for the next algorithms
+                    for (Grid::CellChange &change : changes)
+                    {
+                        change.type = Grid::CellType::EMPTY;
+                    }
+
+                    changed = grid.apply(changes);
+
+                    if (components.has_value())
+                    {
+                        components->update(changed);
+                    }
+                }
+
+                if (queries == 0)
+                {
+                    continue;
+                }
+
+                // random pairs of passable cells, same for every algorithm
+                std::vector<Grid::Location> passable;
+
+                for (Grid::index_t index = 0; index < grid.size(); index++)
+                {
+                    if (grid.isPassable(grid.location(index)))
+                    {
+                        passable.push_back(grid.location(index));
+                    }
+                }
+
+                std::mt19937                          gen(seed + run);
+                std::uniform_int_distribution<size_t> passable_dist(0, passable.size() - 1);
+
+                std::vector<PathQuery<Grid>> batch;
+
+                for (size_t query = 0; query < queries; query++)
+                {
+                    batch.push_back({passable[passable_dist(gen)], passable[passable_dist(gen)]});
+                }
+
+                for (Terminal::Options algorithm_option : algorithms)
+                {
+                    if (!isBatchAlgorithm(algorithm_option))
+                    {
+                        continue;
+                    }
+
+                    std::vector<std::vector<Grid::Location>> paths;
+
+                    timer.tick();
+
+                    if (frontier == "bucket-queue")
+                    {
+                        paths = searchBatch<BucketQueue<Grid::index_t, Grid::cost_t>>(
+                            algorithm_option, grid, batch, pool.value(), alt_landmarks, search_components
+                        );
+                    }
+                    else if (frontier == "indexed-heap")
+                    {
+                        paths = searchBatch<IndexedHeap<Grid::index_t, Grid::cost_t>>(
+                            algorithm_option, grid, batch, pool.value(), alt_landmarks, search_components
+                        );
+                    }
+                    else
+                    {
+                        paths = searchBatch<PriorityQueue<Grid::index_t, Grid::cost_t>>(
+                            algorithm_option, grid, batch, pool.value(), alt_landmarks, search_components
+                        );
+                    }
+
+                    timer.tock();
+
+                    size_t path_length = 0;
+
+                    for (const std::vector<Grid::Location> &path : paths)
+                    {
+                        path_length += path.size();
+                    }
+
+                    std::cout << maze_name << "\t" << run << "\t" << seed + run << "\tbatch-"
+                              << terminal.options[algorithm_option].long_cmd << "\t"
+                              << usedFrontier(algorithm_option, frontier) << "\t" << timer.duration().count()
+                              << "\t-\t" << path_length << std::endl;
+                }
+            }
+        }
+
+        return EXIT_SUCCESS;
+    }
+    catch (const std::exception &e)
+    {
+        terminal.error(e.what());
+        return EXIT_FAILURE;
+    }
+}
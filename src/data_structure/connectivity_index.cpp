@@ -0,0 +1,164 @@
+#include "data_structure/connectivity_index.h"
+
+#include <algorithm>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "data_structure/grid.h"
+
+ConnectivityIndex::ConnectivityIndex(const Grid &grid) : grid(grid)
+{
+    this->build();
+}
+
+void ConnectivityIndex::build()
+{
+    this->parents.assign(this->grid.size(), ConnectivityIndex::NONE);
+    this->sizes.assign(this->grid.size(), 0);
+    this->count = 0;
+
+    // every cell is merged with its west and north neighbors, which were added before it
+    for (int y = 0; y < (int)this->grid.height; y++)
+    {
+        for (int x = 0; x < (int)this->grid.width; x++)
+        {
+            if (!this->grid.isPassable({x, y}))
+            {
+                continue;
+            }
+
+            Grid::index_t index = this->grid.index({x, y});
+
+            this->parents[index] = index;
+            this->sizes[index]   = 1;
+            this->count++;
+
+            if (x > 0 && this->grid.isPassable({x - 1, y}))
+            {
+                this->unite(index, index - 1);
+            }
+
+            if (y > 0 && this->grid.isPassable({x, y - 1}))
+            {
+                this->unite(index, index - (Grid::index_t)this->grid.width);
+            }
+        }
+    }
+
+    // every cell points to its root, so queries on a fresh index take a single step
+    for (Grid::index_t index = 0; index < this->grid.size(); index++)
+    {
+        if (this->parents[index] != ConnectivityIndex::NONE)
+        {
+            this->parents[index] = this->find(index);
+        }
+    }
+}
+
+void ConnectivityIndex::update(const std::vector<Grid::Location> &changed)
+{
+    for (const Grid::Location &location : changed)
+    {
+        if (!this->grid.isPassable(location) && this->parents[this->grid.index(location)] != ConnectivityIndex::NONE)
+        {
+            // closed cell may split its component, which union-find cannot undo
+            this->build();
+            return;
+        }
+    }
+
+    for (const Grid::Location &location : changed)
+    {
+        if (this->grid.isPassable(location) && this->parents[this->grid.index(location)] == ConnectivityIndex::NONE)
+        {
+            this->open(location);
+        }
+    }
+}
+
+Grid::index_t ConnectivityIndex::component(const Grid::Location &location) const
+{
+    Grid::index_t index = this->grid.index(location);
+
+    if (this->parents[index] == ConnectivityIndex::NONE)
+    {
+        return ConnectivityIndex::NONE;
+    }
+
+    return this->find(index);
+}
+
+size_t ConnectivityIndex::componentSize(const Grid::Location &location) const
+{
+    Grid::index_t component = this->component(location);
+    return component == ConnectivityIndex::NONE ? 0 : this->sizes[component];
+}
+
+std::vector<size_t> ConnectivityIndex::componentSizes() const
+{
+    std::vector<size_t> sizes;
+    sizes.reserve(this->count);
+
+    for (Grid::index_t index = 0; index < this->grid.size(); index++)
+    {
+        if (this->parents[index] == index)
+        {
+            sizes.push_back(this->sizes[index]);
+        }
+    }
+
+    std::sort(sizes.begin(), sizes.end(), std::greater<size_t>());
+
+    return sizes;
+}
+
+Grid::index_t ConnectivityIndex::find(Grid::index_t index) const
+{
+    // trees are not compressed on queries, so the index can be read from many threads
+    while (this->parents[index] != index)
+    {
+        index = this->parents[index];
+    }
+
+    return index;
+}
+
+void ConnectivityIndex::unite(const Grid::index_t a, const Grid::index_t b)
+{
+    Grid::index_t root_a = this->find(a);
+    Grid::index_t root_b = this->find(b);
+
+    if (root_a == root_b)
+    {
+        return;
+    }
+
+    // smaller tree goes under the larger one, so trees stay shallow
+    if (this->sizes[root_a] < this->sizes[root_b])
+    {
+        std::swap(root_a, root_b);
+    }
+
+    this->parents[root_b] = root_a;
+    this->sizes[root_a] += this->sizes[root_b];
+    this->count--;
+}
+
+void ConnectivityIndex::open(const Grid::Location &location)
+{
+    Grid::index_t index = this->grid.index(location);
+
+    this->parents[index] = index;
+    this->sizes[index]   = 1;
+    this->count++;
+
+    for (const Grid::Location &neighbor : this->grid.neighbors(location))
+    {
+        // neighbor opened by the same update is merged when its own turn comes
+        if (this->parents[this->grid.index(neighbor)] != ConnectivityIndex::NONE)
+        {
+            this->unite(index, this->grid.index(neighbor));
+        }
+    }
+}
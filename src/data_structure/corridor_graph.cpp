@@ -0,0 +1,197 @@
+#include "data_structure/corridor_graph.h"
+
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "data_structure/grid.h"
+
+CorridorGraph::CorridorGraph(const Grid &grid, const std::vector<Grid::Location> &endpoints)
+    : grid(grid), node_ids(grid.size(), CorridorGraph::NONE)
+{
+    auto addNode = [this](const Grid::Location &location) {
+        if (this->node_ids[this->grid.index(location)] == CorridorGraph::NONE)
+        {
+            this->node_ids[this->grid.index(location)] = (CorridorGraph::index_t)this->nodes.size();
+            this->nodes.push_back(location);
+        }
+    };
+
+    for (const Grid::Location &endpoint : endpoints)
+    {
+        if (!grid.isInBounds(endpoint) || !grid.isPassable(endpoint))
+        {
+            throw std::invalid_argument(
+                "Argument exception: Cannot build corridor graph. Endpoint " + std::to_string(endpoint)
+                + " is not a passable cell."
+            );
+        }
+
+        addNode(endpoint);
+    }
+
+    // every cell that is not in the middle of a corridor is a node
+    for (int y = 0; y < (int)grid.height; y++)
+    {
+        for (int x = 0; x < (int)grid.width; x++)
+        {
+            if (grid.isPassable({x, y}) && grid.neighbors({x, y}).size() != 2)
+            {
+                addNode({x, y});
+            }
+        }
+    }
+
+    this->adjacency.resize(this->nodes.size());
+
+    for (CorridorGraph::index_t from = 0; from < this->nodes.size(); from++)
+    {
+        const Grid::Location &start = this->nodes[from];
+
+        for (uint8_t direction = 0; direction < Grid::directions.size(); direction++)
+        {
+            Grid::Location previous = start;
+            Grid::Location current{start.x + Grid::directions[direction].x, start.y + Grid::directions[direction].y};
+
+            if (!grid.isInBounds(current) || !grid.isPassable(current))
+            {
+                continue;
+            }
+
+            CorridorGraph::cost_t cost = grid.cost(previous, current);
+
+            while (this->node_ids[grid.index(current)] == CorridorGraph::NONE)
+            {
+                Grid::Location next = this->follow(current, previous);
+
+                cost     += grid.cost(current, next);
+                previous  = current;
+                current   = next;
+            }
+
+            CorridorGraph::index_t to = this->node_ids[grid.index(current)];
+
+            // corridor that leads back is never a part of a shortest path
+            if (to == from)
+            {
+                continue;
+            }
+
+            bool is_found = false;
+
+            for (CorridorGraph::Edge &edge : this->adjacency[from])
+            {
+                if (edge.to == to)
+                {
+                    is_found = true;
+
+                    if (cost < edge.cost)
+                    {
+                        edge.cost      = cost;
+                        edge.direction = direction;
+                    }
+                }
+            }
+
+            if (!is_found)
+            {
+                this->adjacency[from].push_back({to, cost, direction});
+            }
+        }
+    }
+}
+
+Grid::NeighborList CorridorGraph::neighbors(const Grid::Location &location) const
+{
+    Grid::NeighborList result;
+
+    for (const CorridorGraph::Edge &edge : this->edges(location))
+    {
+        result.push_back(this->nodes[edge.to]);
+    }
+
+    return result;
+}
+
+CorridorGraph::cost_t CorridorGraph::cost(const Grid::Location &from, const Grid::Location &to) const
+{
+    CorridorGraph::index_t to_index = this->index(to);
+
+    for (const CorridorGraph::Edge &edge : this->edges(from))
+    {
+        if (edge.to == to_index)
+        {
+            return edge.cost;
+        }
+    }
+
+    throw std::invalid_argument(
+        "Argument exception: Cannot get corridor cost. Nodes " + std::to_string(from) + " and " + std::to_string(to)
+        + " are not connected."
+    );
+}
+
+CorridorGraph::cost_t CorridorGraph::heuristic(const Grid::Location &from, const Grid::Location &to)
+{
+    return Grid::heuristic(from, to);
+}
+
+std::vector<Grid::Location> CorridorGraph::expand(const std::vector<Grid::Location> &path) const
+{
+    std::vector<Grid::Location> result;
+
+    if (path.empty())
+    {
+        return result;
+    }
+
+    result.push_back(path.front());
+
+    for (size_t i = 1; i < path.size(); i++)
+    {
+        CorridorGraph::index_t to = this->index(path[i]);
+
+        for (const CorridorGraph::Edge &edge : this->edges(path[i - 1]))
+        {
+            if (edge.to != to)
+            {
+                continue;
+            }
+
+            const Grid::Location &direction = Grid::directions[edge.direction];
+
+            Grid::Location previous = path[i - 1];
+            Grid::Location current{previous.x + direction.x, previous.y + direction.y};
+
+            result.push_back(current);
+
+            while (current != path[i])
+            {
+                Grid::Location next = this->follow(current, previous);
+
+                previous = current;
+                current  = next;
+                result.push_back(current);
+            }
+
+            break;
+        }
+    }
+
+    return result;
+}
+
+Grid::Location CorridorGraph::follow(const Grid::Location &current, const Grid::Location &previous) const
+{
+    for (const Grid::Location &next : this->grid.neighbors(current))
+    {
+        if (next != previous)
+        {
+            return next;
+        }
+    }
+
+    return previous;
+}
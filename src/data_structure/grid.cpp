@@ -3,6 +3,9 @@
 #include <algorithm>
 #include <array>
 #include <chrono>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -14,35 +17,83 @@ const std::array<Grid::Location, 4> Grid::directions = {
     Grid::Location{0,  1 }
 };
 
-Grid::Grid(const size_t width, const size_t height) : width(width), height(height)
+Grid::Grid(const size_t width, const size_t height)
+    : width(Grid::checkSize(width, height)), height(height), row_words((width + 63) / 64), cells(row_words * height, 0)
 {
-    // set entire grid to wall
-    this->grid.reserve(height);
+    // unset bits are walls, so entire grid is already set to wall
+}
 
-    for (size_t i = 0; i < height; i++)
+size_t Grid::checkSize(const size_t width, const size_t height)
+{
+    // division instead of product, so sizes that overflow `size_t` are caught too
+    if (height != 0 && width > (std::numeric_limits<Grid::index_t>::max() - size_t(1)) / height)
     {
-        this->grid.push_back(std::vector<Grid::CellType>(width, Grid::CellType::WALL));
+        throw std::invalid_argument(
+            "Grid exception: Cannot create grid. Grid of size " + std::to_string(width) + "x" + std::to_string(height)
+            + " has too many cells to be indexed."
+        );
     }
+
+    return width;
 }
 
-bool Grid::isInBounds(const Grid::Location &location) const
+void Grid::fill(const Grid::CellType type)
 {
-    return 0 <= location.x && (size_t)location.x < width && 0 <= location.y && (size_t)location.y < height;
+    if (type == Grid::CellType::WALL)
+    {
+        std::fill(this->cells.begin(), this->cells.end(), 0);
+        return;
+    }
+
+    // keep padding bits unset, so they are never passable
+    uint64_t last_word = this->width % 64 == 0 ? ~uint64_t(0) : (uint64_t(1) << (this->width % 64)) - 1;
+
+    for (size_t y = 0; y < this->height; y++)
+    {
+        uint64_t *row = &this->cells[y * this->row_words];
+
+        std::fill(row, row + this->row_words, ~uint64_t(0));
+        row[this->row_words - 1] = last_word;
+    }
 }
 
-bool Grid::isPassable(const Grid::Location &location) const
+std::vector<Grid::Location> Grid::apply(const std::vector<Grid::CellChange> &changes)
 {
-    return this->grid[location.y][location.x] == Grid::CellType::EMPTY;
+    std::vector<Grid::Location> changed;
+
+    for (const Grid::CellChange &change : changes)
+    {
+        if (!this->isInBounds(change.location))
+        {
+            throw std::out_of_range(
+                "Out of range exception: Cannot apply cell change. Location " + std::to_string(change.location)
+                + " is out of bounds."
+            );
+        }
+
+        if ((*this)[change.location] != change.type)
+        {
+            (*this)[change.location] = change.type;
+            changed.push_back(change.location);
+        }
+    }
+
+    return changed;
 }
 
-std::vector<Grid::Location> Grid::neighbors(
+Grid::NeighborList Grid::neighbors(
     const Grid::Location &location, const unsigned distance, const bool is_passable
 ) const
 {
-    std::vector<Grid::Location> result;
+    Grid::NeighborList result;
 
-    for (Grid::Location direction : this->directions)
+    // makes paths look better
+    bool is_reversed = (location.x + location.y) % 2 == 0;
+
+    for (size_t i = 0; i < this->directions.size(); i++)
     {
+        const Grid::Location &direction = this->directions[is_reversed ? this->directions.size() - 1 - i : i];
+
         Grid::Location next{
             (int)(location.x + direction.x + (distance * direction.x)),
             (int)(location.y + direction.y + (distance * direction.y))};
@@ -52,12 +103,6 @@ std::vector<Grid::Location> Grid::neighbors(
         }
     }
 
-    // makes paths look better
-    if ((location.x + location.y) % 2 == 0)
-    {
-        std::reverse(result.begin(), result.end());
-    }
-
     return result;
 }
 
@@ -74,9 +119,40 @@ Grid::cost_t Grid::heuristic(const Grid::Location &from, const Grid::Location &t
     return std::abs(from.x - to.x) + std::abs(from.y - to.y);
 }
 
-Grid::CellType &Grid::operator[](const Grid::Location &location)
+Grid::CellReference Grid::operator[](const Grid::Location &location)
+{
+    return Grid::CellReference(
+        this->cells[location.y * this->row_words + (location.x >> 6)], uint64_t(1) << (location.x & 63)
+    );
+}
+
+Grid::CellType Grid::operator[](const Grid::Location &location) const
+{
+    return this->isPassable(location) ? Grid::CellType::EMPTY : Grid::CellType::WALL;
+}
+
+// CellReference
+Grid::CellReference::CellReference(uint64_t &word, const uint64_t mask) : word(word), mask(mask)
+{
+}
+
+Grid::CellReference &Grid::CellReference::operator=(const Grid::CellType type)
+{
+    if (type == Grid::CellType::EMPTY)
+    {
+        this->word |= this->mask;
+    }
+    else
+    {
+        this->word &= ~this->mask;
+    }
+
+    return *this;
+}
+
+Grid::CellReference::operator Grid::CellType() const
 {
-    return this->grid[location.y][location.x];
+    return (this->word & this->mask) ? Grid::CellType::EMPTY : Grid::CellType::WALL;
 }
 
 // Location
@@ -1,7 +1,9 @@
 #include <ncurses.h>
 #include <stdlib.h>
 
+#include <chrono>
 #include <exception>
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include <vector>
@@ -9,7 +11,21 @@
 #include "algorithm/maze_generator/block_maze_generator.h"
 #include "algorithm/maze_generator/depth_first_search_maze_generator.h"
 #include "algorithm/pathfinder/a_star_search.h"
+#include "algorithm/pathfinder/anytime_a_star_search.h"
+#include "algorithm/pathfinder/bidirectional_a_star_search.h"
+#include "algorithm/pathfinder/bidirectional_dijkstra_search.h"
+#include "algorithm/pathfinder/breadth_first_search.h"
+#include "algorithm/pathfinder/d_star_lite_search.h"
+#include "algorithm/pathfinder/delta_stepping_search.h"
+#include "algorithm/pathfinder/depth_first_search.h"
 #include "algorithm/pathfinder/dijkstra_search.h"
+#include "algorithm/pathfinder/flow_field.h"
+#include "algorithm/pathfinder/fringe_search.h"
+#include "algorithm/pathfinder/greedy_best_first_search.h"
+#include "algorithm/pathfinder/hierarchical_path_finder.h"
+#include "algorithm/pathfinder/iterative_deepening_a_star_search.h"
+#include "algorithm/pathfinder/jump_point_search.h"
+#include "algorithm/pathfinder/landmarks.h"
 #include "data_structure/grid.h"
 #include "renderer/grid_renderer.h"
 #include "utility/terminal.h"
@@ -38,6 +54,20 @@ int main(int argc, char **argv)
 
         addArgument(algorithms, Terminal::Options::DIJKSTRA_ALGORITHM);
         addArgument(algorithms, Terminal::Options::A_STAR_ALGORITHM);
+        addArgument(algorithms, Terminal::Options::ALT_ALGORITHM);
+        addArgument(algorithms, Terminal::Options::ANYTIME_A_STAR_ALGORITHM);
+        addArgument(algorithms, Terminal::Options::IDA_STAR_ALGORITHM);
+        addArgument(algorithms, Terminal::Options::FRINGE_SEARCH_ALGORITHM);
+        addArgument(algorithms, Terminal::Options::BIDIRECTIONAL_DIJKSTRA_ALGORITHM);
+        addArgument(algorithms, Terminal::Options::BIDIRECTIONAL_A_STAR_ALGORITHM);
+        addArgument(algorithms, Terminal::Options::JUMP_POINT_SEARCH_ALGORITHM);
+        addArgument(algorithms, Terminal::Options::BREADTH_FIRST_SEARCH_ALGORITHM);
+        addArgument(algorithms, Terminal::Options::GREEDY_BEST_FIRST_ALGORITHM);
+        addArgument(algorithms, Terminal::Options::DEPTH_FIRST_SEARCH_ALGORITHM);
+        addArgument(algorithms, Terminal::Options::DELTA_STEPPING_ALGORITHM);
+        addArgument(algorithms, Terminal::Options::HIERARCHICAL_ALGORITHM);
+        addArgument(algorithms, Terminal::Options::D_STAR_LITE_ALGORITHM);
+        addArgument(algorithms, Terminal::Options::FLOW_FIELD_ALGORITHM);
 
         if (algorithms.empty())
         {
@@ -71,8 +101,8 @@ int main(int argc, char **argv)
         {
             std::vector<Grid::ChangeRecord> maze_record;
 
-            DepthFirstSearchMazeGenerator depth_first_search_maze_generator;
-            BlockMazeGenerator            block_maze_generator;
+            DepthFirstSearchMazeGenerator<> depth_first_search_maze_generator;
+            BlockMazeGenerator<>            block_maze_generator;
 
             switch (maze_option)
             {
@@ -91,6 +121,7 @@ int main(int argc, char **argv)
             std::vector<std::string>                     algorithm_indexes;
             std::vector<std::vector<Grid::ChangeRecord>> traversed;
             std::vector<std::vector<Grid::Location>>     path;
+            std::optional<FlowField<Grid>>               field;
 
             for (Terminal::Options algorithm_option : algorithms)
             {
@@ -105,7 +136,128 @@ int main(int argc, char **argv)
                 case Terminal::Options::A_STAR_ALGORITHM:
                     algorithm_indexes.push_back("A* Algorithm");
                     traversed.push_back(std::vector<Grid::ChangeRecord>());
-                    path.push_back(AStarSearch<Grid>::search(grid, start, end, Grid::heuristic, traversed.back()));
+                    path.push_back(AStarSearch<Grid>::search(
+                        grid, start, end, ManhattanHeuristic<Grid>(), UnitCost<Grid>(), traversed.back()
+                    ));
+                    break;
+
+                case Terminal::Options::ALT_ALGORITHM: {
+                    Landmarks<Grid> landmarks(grid);
+
+                    algorithm_indexes.push_back("A* with Landmarks");
+                    traversed.push_back(std::vector<Grid::ChangeRecord>());
+                    path.push_back(
+                        AStarSearch<Grid>::search(grid, start, end, landmarks, UnitCost<Grid>(), traversed.back())
+                    );
+                    break;
+                }
+
+                case Terminal::Options::ANYTIME_A_STAR_ALGORITHM: {
+                    algorithm_indexes.push_back("Anytime Repairing A*");
+                    traversed.push_back(std::vector<Grid::ChangeRecord>());
+
+                    // without limits the last path is the cheapest one
+                    std::vector<AnytimeSolution<Grid>> solutions = AnytimeAStarSearch<Grid>::search(
+                        grid,
+                        start,
+                        end,
+                        ManhattanHeuristic<Grid>(),
+                        UnitCost<Grid>(),
+                        AnytimeSchedule(),
+                        &traversed.back()
+                    );
+
+                    path.push_back(solutions.empty() ? std::vector<Grid::Location>() : solutions.back().path);
+                    break;
+                }
+
+                case Terminal::Options::IDA_STAR_ALGORITHM:
+                    algorithm_indexes.push_back("Iterative Deepening A*");
+                    traversed.push_back(std::vector<Grid::ChangeRecord>());
+                    path.push_back(IterativeDeepeningAStarSearch<Grid>::search(
+                        grid, start, end, ManhattanHeuristic<Grid>(), UnitCost<Grid>(), &traversed.back()
+                    ));
+                    break;
+
+                case Terminal::Options::FRINGE_SEARCH_ALGORITHM:
+                    algorithm_indexes.push_back("Fringe Search");
+                    traversed.push_back(std::vector<Grid::ChangeRecord>());
+                    path.push_back(FringeSearch<Grid>::search(
+                        grid, start, end, ManhattanHeuristic<Grid>(), UnitCost<Grid>(), &traversed.back()
+                    ));
+                    break;
+
+                case Terminal::Options::BIDIRECTIONAL_DIJKSTRA_ALGORITHM:
+                    algorithm_indexes.push_back("Bidirectional Dijkstra Algorithm");
+                    traversed.push_back(std::vector<Grid::ChangeRecord>());
+                    path.push_back(BidirectionalDijkstraSearch<Grid>::search(grid, start, end, traversed.back()));
+                    break;
+
+                case Terminal::Options::BIDIRECTIONAL_A_STAR_ALGORITHM:
+                    algorithm_indexes.push_back("Bidirectional A* Algorithm");
+                    traversed.push_back(std::vector<Grid::ChangeRecord>());
+                    path.push_back(
+                        BidirectionalAStarSearch<Grid>::search(grid, start, end, Grid::heuristic, traversed.back())
+                    );
+                    break;
+
+                case Terminal::Options::JUMP_POINT_SEARCH_ALGORITHM:
+                    algorithm_indexes.push_back("Jump Point Search");
+                    traversed.push_back(std::vector<Grid::ChangeRecord>());
+                    path.push_back(JumpPointSearch<Grid>::search(grid, start, end, Grid::heuristic, traversed.back()));
+                    break;
+
+                case Terminal::Options::BREADTH_FIRST_SEARCH_ALGORITHM:
+                    algorithm_indexes.push_back("Breadth First Search");
+                    traversed.push_back(std::vector<Grid::ChangeRecord>());
+                    path.push_back(BreadthFirstSearch<Grid>::search(grid, start, end, traversed.back()));
+                    break;
+
+                case Terminal::Options::GREEDY_BEST_FIRST_ALGORITHM:
+                    algorithm_indexes.push_back("Greedy Best First Search");
+                    traversed.push_back(std::vector<Grid::ChangeRecord>());
+                    path.push_back(
+                        GreedyBestFirstSearch<Grid>::search(grid, start, end, Grid::heuristic, traversed.back())
+                    );
+                    break;
+
+                case Terminal::Options::DEPTH_FIRST_SEARCH_ALGORITHM:
+                    algorithm_indexes.push_back("Depth First Search");
+                    traversed.push_back(std::vector<Grid::ChangeRecord>());
+                    path.push_back(DepthFirstSearch<Grid>::search(grid, start, end, traversed.back()));
+                    break;
+
+                case Terminal::Options::DELTA_STEPPING_ALGORITHM:
+                    algorithm_indexes.push_back("Delta-Stepping");
+                    traversed.push_back(std::vector<Grid::ChangeRecord>());
+                    path.push_back(DeltaSteppingSearch<Grid>::search(grid, start, end, traversed.back()));
+                    break;
+
+                case Terminal::Options::HIERARCHICAL_ALGORITHM:
+                    algorithm_indexes.push_back("Hierarchical A*");
+                    traversed.push_back(std::vector<Grid::ChangeRecord>());
+                    path.push_back(HierarchicalPathFinder<Grid>(grid).search(start, end, traversed.back()));
+                    break;
+
+                case Terminal::Options::D_STAR_LITE_ALGORITHM:
+                    algorithm_indexes.push_back("D* Lite");
+                    traversed.push_back(std::vector<Grid::ChangeRecord>());
+                    path.push_back(DStarLiteSearch<Grid>(grid, start, end, Grid::heuristic).search(traversed.back()));
+                    break;
+
+                case Terminal::Options::FLOW_FIELD_ALGORITHM:
+                    algorithm_indexes.push_back("Flow Field");
+                    traversed.push_back(std::vector<Grid::ChangeRecord>());
+                    field.emplace(grid, end);
+                    path.push_back(field->path(start));
+
+                    // path is read without a search, so only its locations are traversed
+                    for (const Grid::Location &location : path.back().empty() ? std::vector{start} : path.back())
+                    {
+                        traversed.back().push_back(
+                            {location, std::chrono::microseconds(0), 0, field->distance(location)}
+                        );
+                    }
                     break;
 
                 default:
@@ -120,6 +272,12 @@ int main(int argc, char **argv)
 
             renderer.drawPath(is_parallel, algorithm_indexes, traversed, path);
             getch();
+
+            if (field.has_value())
+            {
+                renderer.drawHeatmap("Flow Field", field->distances(), FlowField<Grid>::UNREACHABLE);
+                getch();
+            }
         }
 
         return EXIT_SUCCESS;
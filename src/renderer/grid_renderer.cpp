@@ -273,6 +273,62 @@ void GridRenderer::drawPath(
     this->updateTraversedFinalPath(true, window, result_info, path.back());
 }
 
+void GridRenderer::drawHeatmap(
+    const std::string &title, const std::vector<Grid::cost_t> &distances, const Grid::cost_t unreachable
+)
+{
+    GridRenderer::GridWindow window = this->findWindow(title);
+
+    if (window.grid == nullptr)
+    {
+        throw std::invalid_argument("Grid Renderer exception: Cannot draw heatmap. No window titled '" + title + "'.");
+    }
+
+    Grid::cost_t farthest = 0;
+
+    for (Grid::cost_t distance : distances)
+    {
+        if (distance != unreachable && distance > farthest)
+        {
+            farthest = distance;
+        }
+    }
+
+    const size_t levels = GridRenderer::ColorType::HEATMAP_FARTHEST - GridRenderer::ColorType::HEATMAP_NEAREST + 1;
+
+    // lock threads to render with ncurses
+    std::lock_guard<std::mutex> lock(this->mutex);
+
+    for (size_t index = 0; index < distances.size(); index++)
+    {
+        if (distances[index] == unreachable)
+        {
+            continue;
+        }
+
+        size_t level = (size_t)distances[index] * levels / ((size_t)farthest + 1);
+        attr_t color = COLOR_PAIR(GridRenderer::ColorType::HEATMAP_NEAREST + level) | A_INVIS;
+
+        // draw whole heatmap before refreshing the window once
+        wattron(window.grid, color);
+        mvwaddch(window.grid, index / this->grid_width + 1, index % this->grid_width + 1, ' ');
+        wattroff(window.grid, color);
+    }
+
+    wrefresh(window.grid);
+
+    // status window
+    GridRenderer::clearWindow(window.status);
+    GridRenderer::moveWindowPrint(window.status, 1, 1, "Distances to the goal");
+
+    GridRenderer::moveWindowPrint(window.status, 1, 3, "Farthest distance: ");
+    GridRenderer::attrWindowPrint(
+        window.status, COLOR_PAIR(GridRenderer::ColorType::VALUE), std::to_string(farthest)
+    );
+
+    wrefresh(window.status);
+}
+
 void GridRenderer::updateTraversedPath(
     const bool                           is_end,
     const GridRenderer::GridWindow      &window,
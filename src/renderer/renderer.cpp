@@ -9,15 +9,20 @@
 #include "utility/timer.h"
 
 const std::vector<Renderer::ColorPair> Renderer::color_pairs = {
-    {Renderer::ColorType::TEXT,                       COLOR_WHITE,  COLOR_BLACK},
-    {Renderer::ColorType::VALUE,                      COLOR_YELLOW, COLOR_BLACK},
-    {Renderer::ColorType::EMPTY,                      COLOR_BLACK,  COLOR_BLACK},
-    {Renderer::ColorType::MAZE_TRAVERSED,             -1,           -1         },
-    {Renderer::ColorType::MAZE_CURRENT,               COLOR_RED,    COLOR_RED  },
-    {Renderer::ColorType::WALL,                       COLOR_WHITE,  COLOR_WHITE},
-    {Renderer::ColorType::PATHFINDER_CURRENT,         COLOR_RED,    COLOR_RED  },
-    {Renderer::ColorType::PATHFINDER_TRAVERSED,       COLOR_BLUE,   COLOR_BLUE },
-    {Renderer::ColorType::PATHFINDER_FINAL_TRAVERSED, COLOR_GREEN,  COLOR_GREEN}
+    {Renderer::ColorType::TEXT,                       COLOR_WHITE,  COLOR_BLACK },
+    {Renderer::ColorType::VALUE,                      COLOR_YELLOW, COLOR_BLACK },
+    {Renderer::ColorType::EMPTY,                      COLOR_BLACK,  COLOR_BLACK },
+    {Renderer::ColorType::MAZE_TRAVERSED,             -1,           -1          },
+    {Renderer::ColorType::MAZE_CURRENT,               COLOR_RED,    COLOR_RED   },
+    {Renderer::ColorType::WALL,                       COLOR_WHITE,  COLOR_WHITE },
+    {Renderer::ColorType::PATHFINDER_CURRENT,         COLOR_RED,    COLOR_RED   },
+    {Renderer::ColorType::PATHFINDER_TRAVERSED,       COLOR_BLUE,   COLOR_BLUE  },
+    {Renderer::ColorType::PATHFINDER_FINAL_TRAVERSED, COLOR_GREEN,  COLOR_GREEN },
+    {Renderer::ColorType::HEATMAP_NEAREST,            COLOR_RED,    COLOR_RED   },
+    {Renderer::ColorType::HEATMAP_NEAR,               COLOR_YELLOW, COLOR_YELLOW},
+    {Renderer::ColorType::HEATMAP_MIDDLE,             COLOR_GREEN,  COLOR_GREEN },
+    {Renderer::ColorType::HEATMAP_FAR,                COLOR_CYAN,   COLOR_CYAN  },
+    {Renderer::ColorType::HEATMAP_FARTHEST,           COLOR_BLUE,   COLOR_BLUE  }
 };
 
 Renderer::~Renderer()
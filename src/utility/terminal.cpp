@@ -14,17 +14,31 @@ const std::vector<Terminal::Option> Terminal::options = {
     {"p", "parallel",                false, "",               "",     "Toggle path parallel draw"               },
     {"",  "dijkstra",                false, "pathfinder",     "",     "Dijkstra Search Algorithm"               },
     {"",  "a-star",                  false, "pathfinder",     "",     "A* Search Algorithm"                     },
+    {"",  "alt",                     false, "pathfinder",     "",     "A* with Landmarks (ALT)"                 },
+    {"",  "anytime-a-star",          false, "pathfinder",     "",     "Anytime Repairing A* (ARA*)"             },
+    {"",  "ida-star",                false, "pathfinder",     "",     "Iterative Deepening A* (IDA*)"           },
+    {"",  "fringe-search",           false, "pathfinder",     "",     "Fringe Search Algorithm"                 },
+    {"",  "bidirectional-dijkstra",  false, "pathfinder",     "",     "Bidirectional Dijkstra Search Algorithm" },
+    {"",  "bidirectional-a-star",    false, "pathfinder",     "",     "Bidirectional A* Search Algorithm"       },
+    {"",  "jump-point-search",       false, "pathfinder",     "",     "Jump Point Search Algorithm"             },
+    {"",  "breadth-first-search",    false, "pathfinder",     "",     "Breadth First Search Algorithm"          },
+    {"",  "greedy-best-first",       false, "pathfinder",     "",     "Greedy Best First Search Algorithm"      },
+    {"",  "depth-first-search",      false, "pathfinder",     "",     "Depth First Search Algorithm"            },
+    {"",  "delta-stepping",          false, "pathfinder",     "",     "Parallel Delta-Stepping Algorithm"       },
+    {"",  "hierarchical",            false, "pathfinder",     "",     "Hierarchical Pathfinding A* (HPA*)"      },
+    {"",  "d-star-lite",             false, "pathfinder",     "",     "D* Lite Incremental Search Algorithm"    },
+    {"",  "flow-field",              false, "pathfinder",     "",     "Flow Field towards the goal"             },
     {"",  "maze-depth-first-search", false, "maze generator", "",     "Depth First Search Maze Generator"       },
     {"",  "maze-block",              false, "maze generator", "",     "Block Maze Generator"                    }
 };
 
-Terminal::Terminal(int argc, char **argv)
+Terminal::Terminal(int argc, char **argv, const std::vector<Terminal::Option> &help_options)
 {
     this->arguments = std::vector<std::string>(argv, argv + argc);
 
     if (this->isOptionExists(this->options[Terminal::Options::HELP]))
     {
-        this->help(this->options);
+        this->help(help_options);
     }
 }
 
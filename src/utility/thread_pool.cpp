@@ -0,0 +1,136 @@
+#include "utility/thread_pool.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+ThreadPool::ThreadPool(size_t threads)
+{
+    if (threads == 0)
+    {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    // calling thread is the worker 0
+    for (size_t worker = 1; worker < threads; worker++)
+    {
+        this->threads.push_back(std::thread([this, worker] { this->work(worker); }));
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->is_stopped = true;
+    }
+
+    this->task_condition.notify_all();
+
+    for (std::thread &thread : this->threads)
+    {
+        thread.join();
+    }
+}
+
+ThreadPool &ThreadPool::shared()
+{
+    static ThreadPool pool;
+    return pool;
+}
+
+size_t ThreadPool::size() const
+{
+    return this->threads.size() + 1;
+}
+
+void ThreadPool::run(const std::function<void(size_t)> &task)
+{
+    std::lock_guard<std::mutex> run_lock(this->run_mutex);
+
+    if (this->threads.empty())
+    {
+        task(0);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->task      = &task;
+        this->remaining = this->threads.size();
+        this->error     = nullptr;
+        this->generation++;
+    }
+
+    this->task_condition.notify_all();
+
+    this->attempt(task, 0);
+
+    // workers use `task`, so it must outlive them even if the calling thread threw
+    std::unique_lock<std::mutex> lock(this->mutex);
+    this->done_condition.wait(lock, [this] { return this->remaining == 0; });
+    this->task = nullptr;
+
+    std::exception_ptr error = this->error;
+    this->error              = nullptr;
+
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+}
+
+void ThreadPool::work(const size_t worker)
+{
+    size_t generation = 0;
+
+    while (true)
+    {
+        const std::function<void(size_t)> *task;
+
+        {
+            std::unique_lock<std::mutex> lock(this->mutex);
+            this->task_condition.wait(lock, [this, generation] {
+                return this->is_stopped || this->generation != generation;
+            });
+
+            if (this->is_stopped)
+            {
+                return;
+            }
+
+            generation = this->generation;
+            task       = this->task;
+        }
+
+        this->attempt(*task, worker);
+
+        {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            this->remaining--;
+        }
+
+        this->done_condition.notify_one();
+    }
+}
+
+void ThreadPool::attempt(const std::function<void(size_t)> &task, const size_t worker)
+{
+    try
+    {
+        task(worker);
+    }
+    catch (...)
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+
+        if (!this->error)
+        {
+            this->error = std::current_exception();
+        }
+    }
+}